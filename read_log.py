@@ -0,0 +1,121 @@
+"""
+Reads the logs juicer writes with --log-format jsonl.
+
+Prints the records as text lines, optionally filtered by level, event code, CU or symbol:
+
+    python3 read_log.py juicer.log --event 9d3bc6a4 --cu 12
+    python3 read_log.py juicer.log --events
+
+--events lists every event code in the log with how often it occurs and its format string.
+"""
+import argparse
+import json
+import re
+from collections import Counter
+
+LEVELS = ['error', 'warning', 'info', 'debug']
+
+# C length modifiers Python's % operator does not take.
+__LENGTH_MODIFIERS = re.compile(r'%([-+ #0]*(?:\d+|\*)?(?:\.(?:\d+|\*))?)(?:hh|ll|h|l|j|z|t|L)?([a-zA-Z%])')
+
+
+def __to_python_format(c_format: str) -> str:
+    """
+    Turns a printf format string into one Python's % operator understands.
+    """
+
+    def convert(match) -> str:
+        conversion = match.group(2)
+        if conversion == 'u':
+            conversion = 'd'
+        elif conversion == 'p':
+            conversion = 's'
+        return '%' + match.group(1) + conversion
+
+    return __LENGTH_MODIFIERS.sub(convert, c_format)
+
+
+def __read_records(log_path: str) -> tuple:
+    """
+    Returns the event definitions and the records of the log at log_path.
+    Lines that are not JSON, such as text written before --log-format took effect, are skipped.
+    """
+    formats = {}
+    records = []
+
+    with open(log_path, 'r', encoding='utf-8', errors='replace') as log:
+        for line in log:
+            try:
+                record = json.loads(line)
+            except ValueError:
+                continue
+
+            if 'format' in record:
+                formats[record['event']] = record['format']
+            else:
+                records.append(record)
+
+    return formats, records
+
+
+def __get_message(record: dict, formats: dict) -> str:
+    if 'message' in record:
+        return record['message']
+
+    c_format = formats.get(record.get('event'))
+    args = tuple(record.get('args', []))
+
+    if c_format is None:
+        return 'event {} {}'.format(record.get('event'), list(args))
+
+    try:
+        return __to_python_format(c_format) % args
+    except (TypeError, ValueError):
+        return '{} {}'.format(c_format, list(args))
+
+
+def __matches(record: dict, arguments) -> bool:
+    if arguments.level is not None and LEVELS.index(record.get('level', 'debug')) > LEVELS.index(arguments.level):
+        return False
+    if arguments.event and record.get('event') not in arguments.event:
+        return False
+    if arguments.cu and record.get('cu') not in arguments.cu:
+        return False
+    if arguments.symbol is not None and record.get('symbol') != arguments.symbol:
+        return False
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Read juicer logs written with --log-format jsonl.')
+    parser.add_argument('log', help='Log file written by juicer.')
+    parser.add_argument('--level', choices=LEVELS, help='Only show records at this level or more critical.')
+    parser.add_argument('--event', action='append', default=[], help='Only show this event code. May be repeated.')
+    parser.add_argument('--cu', action='append', default=[], type=int, help='Only show this CU number. May be repeated.')
+    parser.add_argument('--symbol', help='Only show records about this symbol.')
+    parser.add_argument('--events', action='store_true', help='List the event codes with their counts instead.')
+    arguments = parser.parse_args()
+
+    formats, records = __read_records(arguments.log)
+    records = [record for record in records if __matches(record, arguments)]
+
+    if arguments.events:
+        counts = Counter(record.get('event') for record in records if 'event' in record)
+        for event, count in counts.most_common():
+            print('{} {:>10} {}'.format(event, count, formats.get(event, '')))
+        return
+
+    for record in records:
+        context = ''
+        if 'cu' in record:
+            context += ' cu={}'.format(record['cu'])
+        if 'die' in record:
+            context += ' die=0x{:x}'.format(record['die'])
+        if 'symbol' in record:
+            context += ' symbol={}'.format(record['symbol'])
+
+        print('{:<8}{}: {}'.format(record.get('level', '').upper(), context, __get_message(record, formats)))
+
+
+if __name__ == '__main__':
+    main()
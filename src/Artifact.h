@@ -11,29 +11,33 @@
 #include <cstdint>
 #include <string>
 
+#include "InternedString.h"
+
 class ElfFile;
 
 class Artifact
 {
    private:
-    std::string filePath{};
-    ElfFile    &elf;
-    uint32_t    id;
-    std::string md5{"0"};
+    InternedString filePath{};
+    ElfFile       &elf;
+    uint32_t       id;
+    std::string    md5{"0"};
 
    public:
     Artifact(ElfFile &elf, std::string path);
+    Artifact(ElfFile &elf, InternedString path);
     Artifact(ElfFile &elf);
 
     Artifact(const Artifact &artifact);
 
-    void        setId(uint32_t newID);
-    uint32_t    getId();
+    void                  setId(uint32_t newID);
+    uint32_t              getId();
 
-    void        setMD5(std::string newID);
-    std::string getMD5() const;
+    void                  setMD5(std::string newID);
+    std::string           getMD5() const;
 
-    std::string getFilePath() const;
+    const std::string    &getFilePath() const;
+    const InternedString &getInternedFilePath() const;
 
     ~Artifact();
 };
@@ -0,0 +1,96 @@
+/*
+ * BoundedQueue.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_BOUNDEDQUEUE_H_
+#define SRC_BOUNDEDQUEUE_H_
+
+#include <stddef.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+/**
+ *@brief First in, first out queue between a producer and a consumer thread that holds at
+ *most capacity items. A producer that gets that far ahead waits for the consumer.
+ *
+ *@note Closing the queue wakes both sides up. Nothing can be pushed after that, and pop
+ *returns what is left before it reports that the queue is done.
+ */
+template <typename T>
+class BoundedQueue
+{
+   public:
+    explicit BoundedQueue(size_t inCapacity) : capacity{inCapacity > 0 ? inCapacity : 1} {}
+
+    /**
+     *@brief Adds item to the back of the queue, waiting for room first if it is full.
+     *
+     *@return false, without adding item, if the queue is or gets closed.
+     */
+    bool push(T item)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        notFull.wait(lock, [this]() { return closed || items.size() < capacity; });
+
+        if (closed)
+        {
+            return false;
+        }
+
+        items.push_back(std::move(item));
+        notEmpty.notify_one();
+
+        return true;
+    }
+
+    /**
+     *@brief Moves the item at the front of the queue into item, waiting for one first if it is empty.
+     *
+     *@return false if the queue is closed and empty, so no item will ever come.
+     */
+    bool pop(T &item)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        notEmpty.wait(lock, [this]() { return closed || !items.empty(); });
+
+        if (items.empty())
+        {
+            return false;
+        }
+
+        item = std::move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+
+        return true;
+    }
+
+    void close(void)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+        }
+
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+
+    size_t getCapacity(void) const { return capacity; }
+
+   private:
+    const size_t            capacity;
+    std::mutex              mutex;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+    std::deque<T>           items;
+    bool                    closed{false};
+};
+
+#endif /* SRC_BOUNDEDQUEUE_H_ */
@@ -0,0 +1,129 @@
+/*
+ * ChecksumCache.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "ChecksumCache.h"
+
+#include <fstream>
+#include <sstream>
+
+ChecksumCache::ChecksumCache() {}
+
+ChecksumCache::~ChecksumCache() {}
+
+/**
+ *@brief Looks up the checksum of filePath.
+ *
+ *@param algorithm The name of the algorithm the checksum must have been made with.
+ *@param modifiedTime The current modification time of filePath in nanoseconds.
+ *@param size The current size of filePath in bytes.
+ *@param checksum Set to the cached checksum on a hit. Left untouched otherwise.
+ *
+ *@return true if filePath was hashed before with algorithm at the same modification time and size.
+ */
+bool ChecksumCache::lookup(const std::string &filePath, const std::string &algorithm, int64_t modifiedTime, uint64_t size, std::string &checksum)
+{
+    std::lock_guard<std::mutex> lock(entriesMutex);
+
+    bool                        found = false;
+    auto                        entry = entries.find(filePath);
+
+    if (entry != entries.end() && entry->second.algorithm == algorithm && entry->second.modifiedTime == modifiedTime &&
+        entry->second.size == size)
+    {
+        checksum = entry->second.checksum;
+        found    = true;
+        hits++;
+    }
+    else
+    {
+        misses++;
+    }
+
+    return found;
+}
+
+/**
+ *@brief Records checksum as the algorithm checksum of filePath at modifiedTime and size,
+ *replacing any older entry for filePath.
+ */
+void ChecksumCache::insert(const std::string &filePath, const std::string &algorithm, int64_t modifiedTime, uint64_t size, const std::string &checksum)
+{
+    std::lock_guard<std::mutex> lock(entriesMutex);
+
+    entries[filePath] = Entry{modifiedTime, size, algorithm, checksum};
+}
+
+/**
+ *@brief Adds the entries saved in cacheFilePath by save().
+ *Each line has the modification time, size, algorithm, checksum and path of one file.
+ *
+ *@return CHECKSUMCACHE_OK if cacheFilePath was read. A missing file is not an error; it
+ *is what the first run with a new cache file looks like. Returns CHECKSUMCACHE_ERROR if
+ *a line is malformed.
+ */
+int ChecksumCache::load(const std::string &cacheFilePath)
+{
+    int           rc = CHECKSUMCACHE_OK;
+    std::ifstream cacheFile{cacheFilePath};
+    std::string   line{};
+
+    if (!cacheFile)
+    {
+        logger.logInfo("Checksum cache '%s' does not exist yet.", cacheFilePath.c_str());
+        return rc;
+    }
+
+    while (std::getline(cacheFile, line))
+    {
+        std::istringstream lineStream{line};
+        int64_t            modifiedTime = 0;
+        uint64_t           size         = 0;
+        std::string        algorithm{};
+        std::string        checksum{};
+        std::string        filePath{};
+
+        if (lineStream >> modifiedTime >> size >> algorithm >> checksum && lineStream.get() == ' ' && std::getline(lineStream, filePath))
+        {
+            insert(filePath, algorithm, modifiedTime, size, checksum);
+        }
+        else
+        {
+            logger.logError("Malformed line in checksum cache '%s':\"%s\"", cacheFilePath.c_str(), line.c_str());
+            rc = CHECKSUMCACHE_ERROR;
+        }
+    }
+
+    JUICER_LOG_DEBUG(logger, "Loaded %u entries from checksum cache '%s'.", entries.size(), cacheFilePath.c_str());
+
+    return rc;
+}
+
+/**
+ *@brief Writes every entry to cacheFilePath so a later run can load() them.
+ *
+ *@return CHECKSUMCACHE_OK if all entries were written. Otherwise, CHECKSUMCACHE_ERROR.
+ */
+int ChecksumCache::save(const std::string &cacheFilePath)
+{
+    std::lock_guard<std::mutex> lock(entriesMutex);
+
+    int                         rc = CHECKSUMCACHE_OK;
+    std::ofstream               cacheFile{cacheFilePath, std::ios::trunc};
+
+    for (auto &&entry : entries)
+    {
+        cacheFile << entry.second.modifiedTime << " " << entry.second.size << " " << entry.second.algorithm << " " << entry.second.checksum << " "
+                  << entry.first << "\n";
+    }
+
+    if (!cacheFile)
+    {
+        logger.logError("Failed to write checksum cache '%s'.", cacheFilePath.c_str());
+        rc = CHECKSUMCACHE_ERROR;
+    }
+
+    return rc;
+}
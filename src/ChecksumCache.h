@@ -0,0 +1,66 @@
+/*
+ * ChecksumCache.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_CHECKSUMCACHE_H_
+#define SRC_CHECKSUMCACHE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "Logger.h"
+
+#define CHECKSUMCACHE_ERROR -1
+#define CHECKSUMCACHE_OK    0
+
+/**
+ *@brief Remembers the checksum of every file juicer hashed, keyed by path.
+ *
+ *An entry is only valid for the algorithm it was hashed with and while the file keeps
+ *the modification time and size it had when it was hashed, so an edited file is hashed again. Headers that are included
+ *by hundreds of compilation units are hashed once per run instead of once per symbol.
+ *The cache may also be saved to and loaded from a file so unchanged artifacts are not
+ *hashed again on the next run.
+ *
+ *@note This class is thread-safe. Juicer shares one instance with all of its --jobs workers.
+ */
+class ChecksumCache
+{
+   public:
+    ChecksumCache();
+
+    bool     lookup(const std::string &filePath, const std::string &algorithm, int64_t modifiedTime, uint64_t size, std::string &checksum);
+    void     insert(const std::string &filePath, const std::string &algorithm, int64_t modifiedTime, uint64_t size, const std::string &checksum);
+    int      load(const std::string &cacheFilePath);
+    int      save(const std::string &cacheFilePath);
+
+    uint64_t getHits() const { return hits; }
+    uint64_t getMisses() const { return misses; }
+
+    virtual ~ChecksumCache();
+
+   private:
+    struct Entry
+    {
+        int64_t     modifiedTime;
+        uint64_t    size;
+        std::string algorithm;
+        std::string checksum;
+    };
+
+    std::unordered_map<std::string, Entry> entries{};
+    std::mutex                             entriesMutex;
+    /**
+     * Counted under entriesMutex, but read by getHits and getMisses without it.
+     */
+    std::atomic<uint64_t>                  hits{0};
+    std::atomic<uint64_t>                  misses{0};
+    Logger                                 logger;
+};
+
+#endif /* SRC_CHECKSUMCACHE_H_ */
@@ -12,9 +12,9 @@ DefineMacro::DefineMacro(std::string inName, std::string inValue) : name{inName}
     // TODO Auto-generated constructor stub
 }
 
-const std::string& DefineMacro::getName() const { return name; }
+const std::string& DefineMacro::getName() const { return name.str(); }
 
-const std::string& DefineMacro::getValue() const { return value; }
+const std::string& DefineMacro::getValue() const { return value.str(); }
 
 DefineMacro::~DefineMacro()
 {
@@ -8,8 +8,13 @@
 #ifndef SRC_DEFINEMACRO_H_
 #define SRC_DEFINEMACRO_H_
 
+#include <stddef.h>
+
+#include <functional>
 #include <string>
 
+#include "InternedString.h"
+
 class DefineMacro
 {
    public:
@@ -19,11 +24,28 @@ class DefineMacro
 
     const std::string& getValue() const;
 
+    bool operator==(const DefineMacro& other) const { return name == other.name && value == other.value; }
+
     virtual ~DefineMacro();
 
    private:
-    std::string name;
-    std::string value;
+    friend struct std::hash<DefineMacro>;
+
+    InternedString name;
+    InternedString value;
+};
+
+namespace std
+{
+template <>
+struct hash<DefineMacro>
+{
+    size_t operator()(const DefineMacro& macro) const
+    {
+        size_t seed = std::hash<InternedString>()(macro.name);
+        return seed ^ (std::hash<InternedString>()(macro.value) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    }
 };
+}  // namespace std
 
 #endif /* SRC_DEFINEMACRO_H_ */
@@ -5,8 +5,8 @@ Elf32Symbol::Elf32Symbol(Elf32_Sym newSymbol, uint32_t newFileOffset, uint32_t n
 {
 }
 
-Elf32_Sym Elf32Symbol::getSymbol() const { return symbol; }
+const Elf32_Sym& Elf32Symbol::getSymbol() const { return symbol; }
 
-uint32_t  Elf32Symbol::getFileOffset() const { return fileOffset; }
+uint32_t         Elf32Symbol::getFileOffset() const { return fileOffset; }
 
-uint32_t  Elf32Symbol::getStrTableFileOffset() const { return strTableFileOffset; }
+uint32_t         Elf32Symbol::getStrTableFileOffset() const { return strTableFileOffset; }
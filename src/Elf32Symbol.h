@@ -17,9 +17,9 @@ class Elf32Symbol
     uint32_t  strTableFileOffset;
 
    public:
-    Elf32_Sym getSymbol() const;
-    uint32_t  getStrTableFileOffset() const;
-    uint32_t  getFileOffset() const;
+    const Elf32_Sym &getSymbol() const;
+    uint32_t         getStrTableFileOffset() const;
+    uint32_t         getFileOffset() const;
     Elf32Symbol(Elf32_Sym newSymbol, uint32_t newFileOffset, uint32_t newStrTableFileOffset);
 };
 
@@ -17,9 +17,9 @@ class Elf64Symbol
     uint32_t  strTableFileOffset;
 
    public:
-    Elf64_Sym getSymbol() const;
-    uint32_t  getStrTableFileOffset() const;
-    uint32_t  getFileOffset() const;
+    const Elf64_Sym &getSymbol() const;
+    uint32_t         getStrTableFileOffset() const;
+    uint32_t         getFileOffset() const;
     Elf64Symbol(Elf64_Sym newSymbol, uint32_t newFileOffset, uint32_t newStrTableFileOffset);
 };
 
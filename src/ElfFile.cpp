@@ -9,6 +9,8 @@
 
 #include <limits.h>
 
+#include <set>
+
 #include "Enumeration.h"
 #include "Field.h"
 #include "Symbol.h"
@@ -23,7 +25,7 @@ ElfFile::ElfFile(std::string& inName)
       id{0}
 {
     normalizePath(name);
-    logger.logDebug("Elf '%s' created.", getName().c_str());
+    JUICER_LOG_DEBUG(logger, "Elf '%s' created.", getName().c_str());
 }
 
 ElfFile::~ElfFile() {}
@@ -36,7 +38,7 @@ void        ElfFile::setId(uint32_t newId) { id = newId; }
 
 void        ElfFile::isLittleEndian(bool inLittleEndian)
 {
-    logger.logDebug("ELF %s endian changed from %s to %s.", name.c_str(), little_endian ? "LE" : "BE", inLittleEndian ? "LE" : "BE");
+    JUICER_LOG_DEBUG(logger, "ELF %s endian changed from %s to %s.", name.c_str(), little_endian ? "LE" : "BE", inLittleEndian ? "LE" : "BE");
 
     little_endian = inLittleEndian;
 }
@@ -45,7 +47,7 @@ bool ElfFile::isLittleEndian(void) const { return little_endian; }
 
 void ElfFile::setDate(const std::string& inDate)
 {
-    logger.logDebug("ELF %s date changed from %s to %s.", name.c_str(), date.c_str(), inDate.c_str());
+    JUICER_LOG_DEBUG(logger, "ELF %s date changed from %s to %s.", name.c_str(), date.c_str(), inDate.c_str());
 
     this->date = inDate;
 }
@@ -54,12 +56,16 @@ const std::string& ElfFile::getDate() const { return date; }
 
 void               ElfFile::setMD5(std::string inChecksum)
 {
-    logger.logDebug("ELF %s checksum changed from 0x%08x to 0x%08x.", name.c_str(), md5, inChecksum);
+    JUICER_LOG_DEBUG(logger, "ELF %s checksum changed from 0x%08x to 0x%08x.", name.c_str(), md5, inChecksum);
 
     this->md5 = inChecksum;
 }
 
-std::string ElfFile::getMD5() const { return md5; }
+std::string        ElfFile::getMD5() const { return md5; }
+
+void               ElfFile::setChecksumAlgorithm(const std::string& algorithm) { checksumAlgorithm = algorithm; }
+
+const std::string& ElfFile::getChecksumAlgorithm() const { return checksumAlgorithm; }
 
 /**
  *@note IF there is the possibility that this method cannot find the symbol
@@ -72,92 +78,98 @@ std::string ElfFile::getMD5() const { return md5; }
  */
 Symbol*     ElfFile::getSymbol(std::string& name)
 {
-    Symbol* returnSymbol = nullptr;
+    Symbol*        returnSymbol = nullptr;
+    InternedString internedName{};
 
-    for (auto&& symbol : symbols)
+    /* A name that was never interned cannot belong to any symbol. */
+    if (InternedString::find(name, internedName))
     {
-        if (symbol->getName() == name)
-        {
-            returnSymbol = symbol.get();
-        }
+        returnSymbol = getSymbol(internedName);
     }
 
     return returnSymbol;
 }
 
-Symbol* ElfFile::addSymbol(std::string& inName, uint32_t inByteSize, Artifact newArtifact, Symbol* targetSymbol)
+Symbol* ElfFile::getSymbol(const InternedString& name)
 {
-    Symbol* symbol = getSymbol(inName);
+    Symbol* returnSymbol = nullptr;
 
-    if (symbol == nullptr)
+    auto    it           = symbolsByName.find(name);
+
+    if (it != symbolsByName.end())
     {
-        std::unique_ptr<Symbol> newSymbol = std::make_unique<Symbol>(*this, inName, inByteSize, newArtifact);
-        newSymbol->setTargetSymbol(targetSymbol);
+        returnSymbol = it->second;
+    }
+
+    return returnSymbol;
+}
 
-        symbols.push_back(std::move(newSymbol));
+/**
+ *@brief Moves symbol from oldName to its current name in the name index.
+ *Symbol::setName calls this so getSymbol keeps finding renamed symbols.
+ *Symbols that are not owned by this elf are ignored.
+ */
+void ElfFile::renameSymbol(const InternedString& oldName, Symbol& symbol)
+{
+    auto it = symbolsByName.find(oldName);
 
-        symbol = symbols.back().get();
+    if (it != symbolsByName.end() && it->second == &symbol)
+    {
+        symbolsByName.erase(it);
+        symbolsByName.emplace(symbol.getInternedName(), &symbol);
     }
-
-    return symbol;
 }
 
-Symbol* ElfFile::addSymbol(std::string& inName, uint32_t inByteSize, Artifact newArtifact)
+Symbol* ElfFile::addSymbol(std::string& inName, uint32_t inByteSize, Artifact newArtifact, Symbol* targetSymbol)
 {
-    Symbol* symbol = getSymbol(inName);
+    InternedString internedName{inName};
+    Symbol*        symbol = getSymbol(internedName);
 
     if (symbol == nullptr)
     {
-        std::unique_ptr<Symbol> newSymbol = std::make_unique<Symbol>(*this, inName, inByteSize, newArtifact);
-
-        symbols.push_back(std::move(newSymbol));
+        symbol = arena.create<Symbol>(*this, internedName, inByteSize, newArtifact);
+        symbol->setTargetSymbol(targetSymbol);
 
-        symbol = symbols.back().get();
+        symbols.push_back(symbol);
+        symbolsByName.emplace(internedName, symbol);
     }
 
     return symbol;
 }
 
-std::vector<std::unique_ptr<Symbol>>& ElfFile::getSymbols() { return symbols; }
-
-std::vector<Field*>                   ElfFile::getFields()
+Symbol* ElfFile::addSymbol(std::string& inName, uint32_t inByteSize, Artifact newArtifact)
 {
-    std::vector<Field*> outFields      = std::vector<Field*>();
-    /**
-     *@note numberOfFields could be used for pre-allocating space for the vector.
-     */
-    int                 numberOfFields = 0;
+    InternedString internedName{inName};
+    Symbol*        symbol = getSymbol(internedName);
 
-    for (auto&& symbol : symbols)
+    if (symbol == nullptr)
     {
-        numberOfFields += symbol->getFields().size();
-    }
+        symbol = arena.create<Symbol>(*this, internedName, inByteSize, newArtifact);
 
-    for (auto&& symbol : symbols)
-    {
-        for (auto&& field : symbol->getFields())
-        {
-            outFields.push_back(field.get());
-        }
+        symbols.push_back(symbol);
+        symbolsByName.emplace(internedName, symbol);
     }
 
-    return outFields;
+    return symbol;
 }
 
-std::vector<Enumeration*> ElfFile::getEnumerations()
-{
-    std::vector<Enumeration*> outEnumerations = std::vector<Enumeration*>();
+std::vector<Symbol*>& ElfFile::getSymbols() { return symbols; }
 
-    for (auto&& symbol : symbols)
-    {
-        for (auto&& enumeration : symbol->getEnumerations())
-        {
-            outEnumerations.push_back(enumeration.get());
-        }
-    }
+ObjectArena&          ElfFile::getArena() { return arena; }
 
-    return outEnumerations;
-}
+std::vector<Field*>&       getSymbolFields(Symbol& symbol) { return symbol.getFields(); }
+
+std::vector<Enumeration*>& getSymbolEnumerations(Symbol& symbol) { return symbol.getEnumerations(); }
+
+/**
+ *@return The fields of every symbol, symbol by symbol. Nothing is copied.
+ */
+FieldView                  ElfFile::getFields() const { return FieldView{symbols}; }
+
+/**
+ *@return The enumerations of every symbol, symbol by symbol. Nothing is copied.
+ */
+EnumerationView            ElfFile::getEnumerations() const { return EnumerationView{symbols}; }
 
 /**
  *Converts the path into an absolute path.
@@ -176,7 +188,21 @@ void ElfFile::normalizePath(std::string& path)
     path.insert(0, resolvedPath);
 }
 
-void                                               ElfFile::addDefineMacro(DefineMacro newMacro) { defineMacros.push_back(newMacro); }
+/**
+ *@return true if newMacro was added, false if the same name and value were already there.
+ */
+bool ElfFile::addDefineMacro(DefineMacro newMacro)
+{
+    bool isNew = defineMacroSet.insert(newMacro).second;
+
+    if (isNew)
+    {
+        defineMacros.push_back(std::move(newMacro));
+    }
+
+    return isNew;
+}
+
 const std::vector<DefineMacro>&                    ElfFile::getDefineMacros() const { return defineMacros; }
 
 const std::map<std::string, std::vector<uint8_t>>& ElfFile::getInitializedSymbolData() const { return initializedSymbolData; }
@@ -185,31 +211,38 @@ void                                               ElfFile::setInitializedSymbol
     this->initializedSymbolData = initializedSymbolData;
 }
 
-void                         ElfFile::addVariable(Variable newVariable) { variables.push_back(newVariable); }
+void ElfFile::setInitializedSymbolData(std::map<std::string, std::vector<uint8_t>>&& initializedSymbolData)
+{
+    this->initializedSymbolData = std::move(initializedSymbolData);
+}
+
+void                            ElfFile::addVariable(Variable newVariable) { variables.push_back(std::move(newVariable)); }
 
-const std::vector<Variable>& ElfFile::getVariables() const { return variables; }
+const std::vector<Variable>&    ElfFile::getVariables() const { return variables; }
 
-void                         ElfFile::addElf32SectionHeader(Elf32_Shdr newSectionHeader) { elf32Headers.push_back(newSectionHeader); }
-void                         ElfFile::addElf64SectionHeader(Elf64_Shdr newSectionHeader) { elf64Headers.push_back(newSectionHeader); }
+void                            ElfFile::addElf32SectionHeader(const Elf32_Shdr& newSectionHeader) { elf32Headers.push_back(newSectionHeader); }
+void                            ElfFile::addElf64SectionHeader(const Elf64_Shdr& newSectionHeader) { elf64Headers.push_back(newSectionHeader); }
 
-std::vector<Elf32_Shdr>      ElfFile::getElf32Headers() const { return elf32Headers; }
-std::vector<Elf64_Shdr>      ElfFile::getElf64Headers() const { return elf64Headers; }
+const std::vector<Elf32_Shdr>&  ElfFile::getElf32Headers() const { return elf32Headers; }
+const std::vector<Elf64_Shdr>&  ElfFile::getElf64Headers() const { return elf64Headers; }
 
-void                         ElfFile::addElf32SymbolTableSymbol(Elf32Symbol newSymbol) { elf32SymbolTable.push_back(newSymbol); }
-std::vector<Elf32Symbol>     ElfFile::getElf32SymbolTable() const { return elf32SymbolTable; }
+void                            ElfFile::addElf32SymbolTableSymbol(Elf32Symbol newSymbol) { elf32SymbolTable.push_back(std::move(newSymbol)); }
+const std::vector<Elf32Symbol>& ElfFile::getElf32SymbolTable() const { return elf32SymbolTable; }
 
-void                         ElfFile::addElf64SymbolTableSymbol(Elf64Symbol newSymbol) { elf64SymbolTable.push_back(newSymbol); }
-std::vector<Elf64Symbol>     ElfFile::getElf64SymbolTable() const { return elf64SymbolTable; }
+void                            ElfFile::addElf64SymbolTableSymbol(Elf64Symbol newSymbol) { elf64SymbolTable.push_back(std::move(newSymbol)); }
+const std::vector<Elf64Symbol>& ElfFile::getElf64SymbolTable() const { return elf64SymbolTable; }
 
 /**
  * @brief ElfFile::getEncodings
  * @return a list of encodings as per DWARF5 specification document section 5.1.1 titled "Base Type Encodings"
  */
-std::vector<Encoding>        ElfFile::getDWARFEncodings()
+std::vector<Encoding>           ElfFile::getDWARFEncodings()
 {
     std::vector<Encoding> encodings{};
 
-    for (std::pair<int, Encoding> e : encodingsMap)
+    encodings.reserve(encodingsMap.size());
+
+    for (auto&& e : encodingsMap)
     {
         encodings.push_back(e.second);
     }
@@ -239,3 +272,100 @@ void      ElfFile::setElfClass(int newelfClass)
 }
 
 int ElfFile::getElfClass() { return elfClass; }
+
+/**
+ *@brief Folds the symbols, macros and variables of partial into this elf.
+ *
+ *Symbols go through the same name-based dedup as addSymbol, so the first elf
+ *to define a name wins. Merging per-CU partials in CU order therefore yields the same
+ *symbols, fields and enumerations as reading those CUs one after the other into this elf.
+ *This is how Juicer combines the results of its CU workers.
+ *
+ *@note Nothing in this elf points into partial afterwards, so partial may be destroyed.
+ */
+void ElfFile::merge(ElfFile &partial)
+{
+    std::map<const Symbol *, Symbol *> symbolMap{};
+    std::set<Symbol *>                 newSymbols{};
+
+    /* Resolve every symbol first, since fields and targets may point forward. */
+    for (auto &&partialSymbol : partial.getSymbols())
+    {
+        Symbol *symbol = getSymbol(partialSymbol->getInternedName());
+
+        if (symbol == nullptr)
+        {
+            std::string name = partialSymbol->getName();
+            Artifact    newArtifact{*this, partialSymbol->getArtifact().getInternedFilePath()};
+            newArtifact.setMD5(partialSymbol->getArtifact().getMD5());
+
+            symbol = addSymbol(name, partialSymbol->getByteSize(), newArtifact);
+            symbol->setEncoding(partialSymbol->getEncoding());
+            newSymbols.insert(symbol);
+        }
+
+        symbolMap[partialSymbol] = symbol;
+    }
+
+    auto mapSymbol = [&](const Symbol &partialSymbol) -> Symbol * {
+        auto it = symbolMap.find(&partialSymbol);
+        if (it != symbolMap.end())
+        {
+            return it->second;
+        }
+
+        return getSymbol(partialSymbol.getInternedName());
+    };
+
+    for (auto &&partialSymbol : partial.getSymbols())
+    {
+        Symbol *symbol   = symbolMap.at(partialSymbol);
+        bool    isNew    = newSymbols.find(symbol) != newSymbols.end();
+
+        if (isNew && partialSymbol->hasTargetSymbol())
+        {
+            symbol->setTargetSymbol(mapSymbol(*partialSymbol->getTargetSymbol()));
+        }
+
+        for (auto &&field : partialSymbol->getFields())
+        {
+            Symbol *type = mapSymbol(field->getType());
+
+            if (type == nullptr)
+            {
+                logger.logWarning("Dropping field %s::%s. Its type %s was not found.", symbol->getName().c_str(), field->getName().c_str(),
+                                  field->getType().getName().c_str());
+                continue;
+            }
+
+            symbol->addField(field->getName(), field->getByteOffset(), *type, field->getDimensionList(), field->isLittleEndian(), field->getBitSize(),
+                             field->getBitOffset());
+        }
+
+        /* Symbol does not deduplicate enumerators, and re-reading an enum sets its encoding again. */
+        for (auto &&enumeration : partialSymbol->getEnumerations())
+        {
+            symbol->addEnumeration(enumeration->getName(), enumeration->getValue());
+        }
+
+        if (!isNew && partialSymbol->getEnumerations().size() > 0)
+        {
+            symbol->setEncoding(partialSymbol->getEncoding());
+        }
+    }
+
+    for (auto &&macro : partial.getDefineMacros())
+    {
+        addDefineMacro(macro);
+    }
+
+    for (auto &&variable : partial.getVariables())
+    {
+        Symbol *type = mapSymbol(variable.getType());
+
+        if (type != nullptr)
+        {
+            addVariable(Variable{variable.getName(), *type, *this});
+        }
+    }
+}
@@ -11,7 +11,10 @@
 #include <libelf.h>
 #include <stdint.h>
 
+#include <map>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "DefineMacro.h"
@@ -19,8 +22,11 @@
 #include "Elf64Symbol.h"
 #include "Encoding.h"
 #include "Field.h"
+#include "InternedString.h"
 #include "Juicer.h"
 #include "Logger.h"
+#include "ObjectArena.h"
+#include "SymbolMemberView.h"
 #include "Variable.h"
 #include "dwarf.h"
 
@@ -29,6 +35,12 @@ class Field;
 class Enumeration;
 class Variable;
 
+std::vector<Field *>                                        &getSymbolFields(Symbol &symbol);
+std::vector<Enumeration *>                                  &getSymbolEnumerations(Symbol &symbol);
+
+typedef SymbolMemberView<Field, getSymbolFields>             FieldView;
+typedef SymbolMemberView<Enumeration, getSymbolEnumerations> EnumerationView;
+
 /**
  * The elf class contains an "module" with a user-defined name.
  * It is an aggregation of Symbols, fields, bit fields and enumerations. It also
@@ -36,52 +48,58 @@ class Variable;
  * management with new/delete. Do not allocate this class with the "new" as
  * that will make our design error-prone and result in undefined behavior.
  *
- *@note This is an "owning class". This means that it manages some resources through unique_ptr
- *for this class that will be the elfFiles and symbols object. This means the lifetime
- *of Symbol and ElfFile objects depend on the lifetime of Module; once Module is out of scope
- *then symbols, elfFiles and every unique pointer they contains will be destroyed automatically.
+ *@note This is an "owning class". Its symbols, and their fields and enumerations, live in
+ *the ElfFile's arena. This means the lifetime of Symbol, Field and Enumeration objects depends
+ *on the lifetime of the ElfFile; once the ElfFile is out of scope they are all destroyed
+ *together.
  */
 class ElfFile
 {
    public:
     ElfFile(std::string &name);
     virtual ~ElfFile();
-    std::vector<std::unique_ptr<Symbol>>              &getSymbols();
+    std::vector<Symbol *>                             &getSymbols();
+    ObjectArena                                       &getArena();
 
     std::string                                        getName() const;
     uint32_t                                           getId(void) const;
     void                                               setId(uint32_t newId);
     Symbol                                            *addSymbol(std::string &name, uint32_t byte_size, Artifact newArtifact);
     Symbol                                            *addSymbol(std::string &inName, uint32_t inByteSize, Artifact newArtifact, Symbol *targetSymbol);
-    std::vector<Field *>                               getFields();
-    std::vector<Enumeration *>                         getEnumerations();
+    FieldView                                          getFields() const;
+    EnumerationView                                    getEnumerations() const;
     Symbol                                            *getSymbol(std::string &name);
+    Symbol                                            *getSymbol(const InternedString &name);
+    void                                               renameSymbol(const InternedString &oldName, Symbol &symbol);
     const std::string                                 &getDate() const;
     void                                               setDate(const std::string &date);
     bool                                               isLittleEndian() const;
     void                                               isLittleEndian(bool littleEndian);
     void                                               setMD5(std::string newID);
     std::string                                        getMD5() const;
-    void                                               addDefineMacro(DefineMacro newMacro);
+    void                                               setChecksumAlgorithm(const std::string &algorithm);
+    const std::string                                 &getChecksumAlgorithm() const;
+    bool                                               addDefineMacro(DefineMacro newMacro);
 
     const std::vector<DefineMacro>                    &getDefineMacros() const;
 
     const std::map<std::string, std::vector<uint8_t>> &getInitializedSymbolData() const;
 
     void                                               setInitializedSymbolData(const std::map<std::string, std::vector<uint8_t>> &initializedSymbolData);
+    void                                               setInitializedSymbolData(std::map<std::string, std::vector<uint8_t>> &&initializedSymbolData);
     void                                               addVariable(Variable newVariable);
     const std::vector<Variable>                       &getVariables() const;
-    void                                               addElf32SectionHeader(Elf32_Shdr newVariable);
-    std::vector<Elf32_Shdr>                            getElf32Headers() const;
+    void                                               addElf32SectionHeader(const Elf32_Shdr &newVariable);
+    const std::vector<Elf32_Shdr>                     &getElf32Headers() const;
 
-    void                                               addElf64SectionHeader(Elf64_Shdr newVariable);
-    std::vector<Elf64_Shdr>                            getElf64Headers() const;
+    void                                               addElf64SectionHeader(const Elf64_Shdr &newVariable);
+    const std::vector<Elf64_Shdr>                     &getElf64Headers() const;
 
     void                                               addElf32SymbolTableSymbol(Elf32Symbol newSymbol);
-    std::vector<Elf32Symbol>                           getElf32SymbolTable() const;
+    const std::vector<Elf32Symbol>                    &getElf32SymbolTable() const;
 
     void                                               addElf64SymbolTableSymbol(Elf64Symbol newSymbol);
-    std::vector<Elf64Symbol>                           getElf64SymbolTable() const;
+    const std::vector<Elf64Symbol>                    &getElf64SymbolTable() const;
 
     std::vector<Encoding>                              getDWARFEncodings();
 
@@ -90,9 +108,20 @@ class ElfFile
     int                                                getElfClass();
 
     void                                               setElfClass(int newelfClass);
+    void                                               merge(ElfFile &partial);
 
    private:
-    std::string                                 md5;
+    /**
+     * Owns the symbols of this elf and their fields and enumerations. Declared first so
+     * it is destroyed last, after everything that points into it.
+     */
+    ObjectArena                                  arena{};
+    std::string                                  md5;
+    /**
+     * Name of the algorithm md5 and the checksums of this elf's artifacts were made with.
+     * The column keeps its historical name even when the algorithm is not MD5.
+     */
+    std::string                                  checksumAlgorithm{"md5"};
     /**
      *@note I'm not sure about date being a std::string. I wonder if it'll
      * become problematic with other formats other than SQLite...dates and
@@ -101,15 +130,26 @@ class ElfFile
      * for dealing with times and dates. C++20 does. We could probably just
      * use C-style ctime headers to handle this.
      */
-    std::string                                 date;
-    bool                                        little_endian;
-    std::string                                 name;
-    uint32_t                                    id;
-    Logger                                      logger;
-    std::vector<std::unique_ptr<Symbol>>        symbols;
+    std::string                                  date;
+    bool                                         little_endian;
+    std::string                                  name;
+    uint32_t                                     id;
+    Logger                                       logger;
+    std::vector<Symbol *>                        symbols;
+    /**
+     *Index over symbols by name so getSymbol and addSymbol do not need to scan symbols.
+     *Every symbol in symbols has exactly one entry here. Keys are interned, so probing
+     *hashes and compares a pointer instead of the name.
+     */
+    std::unordered_map<InternedString, Symbol *> symbolsByName{};
 
     void                                        normalizePath(std::string &);
     std::vector<DefineMacro>                    defineMacros{};
+    /**
+     *Every CU that includes a header defines its macros again. This holds what is already
+     *in defineMacros, so each name and value pair is kept once, in the order first seen.
+     */
+    std::unordered_set<DefineMacro>             defineMacroSet{};
     std::vector<Variable>                       variables{};
 
     /**
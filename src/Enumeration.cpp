@@ -7,6 +7,8 @@
 
 #include "Enumeration.h"
 
+Logger Enumeration::logger;
+
 Enumeration::Enumeration(Symbol& inSymbol)
     : symbol{inSymbol},  // @suppress("Symbol is not resolved")
       name{""},
@@ -14,7 +16,7 @@ Enumeration::Enumeration(Symbol& inSymbol)
       short_description{""},
       long_description{""}
 {
-    logger.logDebug("ENUM %s:%s  value:%u  created.", symbol.getName().c_str(), name.c_str(), value);
+    JUICER_LOG_DEBUG(logger, "ENUM %s:%s  value:%u  created.", symbol.getName().c_str(), name.c_str(), value);
 }
 
 Enumeration::Enumeration(Symbol& inSymbol, std::string& inName, int64_t inValue)
@@ -24,7 +26,7 @@ Enumeration::Enumeration(Symbol& inSymbol, std::string& inName, int64_t inValue)
       short_description{""},
       long_description{""}
 {
-    logger.logDebug("ENUM %s:%s  value:%u  created.", symbol.getName().c_str(), name.c_str(), value);
+    JUICER_LOG_DEBUG(logger, "ENUM %s:%s  value:%u  created.", symbol.getName().c_str(), name.c_str(), value);
 }
 
 Enumeration::~Enumeration() {}
@@ -33,7 +35,7 @@ std::string& Enumeration::getName() { return name; }
 
 void         Enumeration::setName(std::string& inName)
 {
-    logger.logDebug("ENUM %s:%s renamed to %s.", symbol.getName().c_str(), name.c_str(), inName.c_str());
+    JUICER_LOG_DEBUG(logger, "ENUM %s:%s renamed to %s.", symbol.getName().c_str(), name.c_str(), inName.c_str());
 
     this->name = inName;
 }
@@ -44,7 +46,7 @@ int64_t Enumeration::getValue() { return value; }
 
 void    Enumeration::setValue(int64_t inValue)
 {
-    logger.logDebug("ENUM %s:%s value changed from %i to %i.", symbol.getName().c_str(), name.c_str(), value, inValue);
+    JUICER_LOG_DEBUG(logger, "ENUM %s:%s value changed from %i to %i.", symbol.getName().c_str(), name.c_str(), value, inValue);
 
     this->value = inValue;
 }
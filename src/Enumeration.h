@@ -32,18 +32,18 @@ class Enumeration
     const std::string& getLongDescription() const { return long_description; }
 
    private:
-    Symbol&     symbol;
-    std::string name;
+    Symbol&       symbol;
+    std::string   name;
     /**
      *@note I think, since these structures are dependent on the dwarf data
      *types such as Dwarf_Unsigned, we should use those data types directly
      *to avoid casting and ambiguity when passing data around.
      */
-    int64_t     value;
-    Logger      logger;
+    int64_t       value;
+    static Logger logger;
 
-    std::string short_description;
-    std::string long_description;
+    std::string   short_description;
+    std::string   long_description;
 };
 
 #endif /* ENUMERATION_H_ */
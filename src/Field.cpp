@@ -7,9 +7,11 @@
 
 #include "Field.h"
 
+Logger Field::logger;
+
 Field::Field(Symbol& inSymbol, Symbol& inType)
     : symbol{inSymbol},  // @suppress("Symbol is not resolved")
-      name{""},
+      name{},
       byte_offset{0},
       type{inType},  // @suppress("Symbol is not resolved")
       dimensionList{},
@@ -18,11 +20,11 @@ Field::Field(Symbol& inSymbol, Symbol& inType)
       short_description{""},
       long_description{""}
 {
-    logger.logDebug("Field %s::%s  byte_offset=%u  type=%s  multiplicity=%s  endian=%s  created.", symbol.getName().c_str(), name.c_str(), byte_offset,
-                    type.getName().c_str(), dimensionList.toString(), little_endian ? "LE" : "BE");
+    JUICER_LOG_DEBUG(logger, "Field %s::%s  byte_offset=%u  type=%s  multiplicity=%s  endian=%s  created.", symbol.getName().c_str(), name.c_str(), byte_offset,
+                     type.getName().c_str(), dimensionList.toString().c_str(), little_endian ? "LE" : "BE");
 }
 
-Field::Field(Symbol& inSymbol, std::string& inName, uint32_t inByteOffset, Symbol& inType, DimensionList& inDimensionList, bool inLittleEndian,
+Field::Field(Symbol& inSymbol, const std::string& inName, uint32_t inByteOffset, Symbol& inType, DimensionList& inDimensionList, bool inLittleEndian,
              uint32_t inBitSize, uint32_t inBitOffset)
     : symbol{inSymbol},  // @suppress("Symbol is not resolved")
       name{inName},      // @suppress("Symbol is not resolved")
@@ -37,11 +39,11 @@ Field::Field(Symbol& inSymbol, std::string& inName, uint32_t inByteOffset, Symbo
       long_description{""}
 
 {
-    logger.logDebug("Field %s::%s  byte_offset=%u  type=%s  multiplicity=%s  endian=%s  created.", symbol.getName().c_str(), name.c_str(), byte_offset,
-                    type.getName().c_str(), dimensionList.toString(), little_endian ? "LE" : "BE");
+    JUICER_LOG_DEBUG(logger, "Field %s::%s  byte_offset=%u  type=%s  multiplicity=%s  endian=%s  created.", symbol.getName().c_str(), name.c_str(), byte_offset,
+                     type.getName().c_str(), dimensionList.toString().c_str(), little_endian ? "LE" : "BE");
 }
 
-Field::Field(Symbol& inSymbol, std::string& inName, uint32_t inByteOffset, Symbol& inType, bool inLittleEndian, uint32_t inBitSize, uint32_t inBitOffset)
+Field::Field(Symbol& inSymbol, const std::string& inName, uint32_t inByteOffset, Symbol& inType, bool inLittleEndian, uint32_t inBitSize, uint32_t inBitOffset)
     : symbol{inSymbol},  // @suppress("Symbol is not resolved")
       name{inName},      // @suppress("Symbol is not resolved")
       byte_offset{inByteOffset},
@@ -55,8 +57,8 @@ Field::Field(Symbol& inSymbol, std::string& inName, uint32_t inByteOffset, Symbo
       long_description{""}
 
 {
-    logger.logDebug("Field %s::%s  byte_offset=%u  type=%s  multiplicity=%s  endian=%s  created.", symbol.getName().c_str(), name.c_str(), byte_offset,
-                    type.getName().c_str(), dimensionList.toString(), little_endian ? "LE" : "BE");
+    JUICER_LOG_DEBUG(logger, "Field %s::%s  byte_offset=%u  type=%s  multiplicity=%s  endian=%s  created.", symbol.getName().c_str(), name.c_str(), byte_offset,
+                     type.getName().c_str(), dimensionList.toString().c_str(), little_endian ? "LE" : "BE");
 }
 Field::~Field() {}
 
@@ -64,13 +66,15 @@ uint32_t     Field::getByteOffset() const { return byte_offset; }
 
 bool         Field::isLittleEndian() const { return little_endian; }
 
-std::string& Field::getName() { return name; }
+const std::string&    Field::getName() const { return name.str(); }
+
+const InternedString& Field::getInternedName() const { return name; }
 
-void         Field::setName(const std::string& inName)
+void                  Field::setName(const std::string& inName)
 {
-    logger.logDebug("Field %s::%s  renamed  to %s.", symbol.getName().c_str(), name.c_str(), inName.c_str());
+    JUICER_LOG_DEBUG(logger, "Field %s::%s  renamed  to %s.", symbol.getName().c_str(), name.c_str(), inName.c_str());
 
-    this->name = inName;
+    this->name = InternedString{inName};
 }
 
 Symbol& Field::getSymbol() const { return symbol; }
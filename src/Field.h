@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "DimensionList.h"
+#include "InternedString.h"
 #include "Logger.h"
 #include "Symbol.h"
 
@@ -30,17 +31,18 @@ class Field
 {
    public:
     Field(Symbol &symbol, Symbol &type);
-    Field(Symbol &symbol, std::string &name, uint32_t byte_offset, Symbol &type, DimensionList &dimensionList, bool little_endian, uint32_t inBitSize = 0,
-          uint32_t inBitOffset = 0);
-    Field(Symbol &symbol, std::string &name, uint32_t byte_offset, Symbol &type, bool little_endian, uint32_t inBitSize = 0, uint32_t inBitOffset = 0);
+    Field(Symbol &symbol, const std::string &name, uint32_t byte_offset, Symbol &type, DimensionList &dimensionList, bool little_endian,
+          uint32_t inBitSize = 0, uint32_t inBitOffset = 0);
+    Field(Symbol &symbol, const std::string &name, uint32_t byte_offset, Symbol &type, bool little_endian, uint32_t inBitSize = 0, uint32_t inBitOffset = 0);
     virtual ~Field();
     uint32_t           getByteOffset() const;
     bool               isLittleEndian() const;
     uint32_t           getMultiplicity() const;
     uint32_t           getArraySize() const;
     void               setMultiplicity(uint32_t multiplicity);
-    std::string       &getName();
-    void               setName(const std::string &name);
+    const std::string    &getName() const;
+    const InternedString &getInternedName() const;
+    void                  setName(const std::string &name);
     Symbol            &getSymbol() const;
     Symbol            &getType();
     uint32_t           getId(void) const;
@@ -59,21 +61,21 @@ class Field
     const std::string &getLongDescription() const { return long_description; }
 
    private:
-    Symbol       &symbol;
-    std::string   name;
-    uint32_t      byte_offset;
-    Symbol       &type;
-    DimensionList dimensionList;
-    bool          little_endian;
+    Symbol        &symbol;
+    InternedString name;
+    uint32_t       byte_offset;
+    Symbol        &type;
+    DimensionList  dimensionList;
+    bool           little_endian;
     /*bit fields members.
      * If this field is not bit-packed, then the bit_size and bit_offset are 0.*/
-    uint32_t      bit_offset;
-    uint32_t      bit_size;
-    Logger        logger;
-    uint32_t      id;
+    uint32_t       bit_offset;
+    uint32_t       bit_size;
+    static Logger  logger;
+    uint32_t       id;
 
-    std::string   short_description;
-    std::string   long_description;
+    std::string    short_description;
+    std::string    long_description;
 };
 
 #endif /* FIELD_H_ */
@@ -0,0 +1,269 @@
+/*
+ * FileChecksum.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "FileChecksum.h"
+
+#include <fcntl.h>
+#include <openssl/evp.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <iomanip>
+#include <sstream>
+
+/**
+ *Bytes handed to EVP_DigestUpdate at a time. Walking the mapping in chunks lets the kernel
+ *drop pages we are done with instead of keeping the whole file resident.
+ */
+#define FILE_CHECKSUM_CHUNK_SIZE (1 << 20)
+
+#define XXH64_PRIME_1            0x9E3779B185EBCA87ULL
+#define XXH64_PRIME_2            0xC2B2AE3D27D4EB4FULL
+#define XXH64_PRIME_3            0x165667B19E3779F9ULL
+#define XXH64_PRIME_4            0x85EBCA77C2B2AE63ULL
+#define XXH64_PRIME_5            0x27D4EB2F165667C5ULL
+
+static inline uint64_t xxh64Rotl(uint64_t value, int bits) { return (value << bits) | (value >> (64 - bits)); }
+
+static inline uint64_t xxh64Read64(const uint8_t *p)
+{
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) | ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) |
+           ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
+
+static inline uint32_t xxh64Read32(const uint8_t *p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+static inline uint64_t xxh64Round(uint64_t acc, uint64_t input)
+{
+    acc += input * XXH64_PRIME_2;
+    acc  = xxh64Rotl(acc, 31);
+    return acc * XXH64_PRIME_1;
+}
+
+static inline uint64_t xxh64MergeRound(uint64_t acc, uint64_t value)
+{
+    acc ^= xxh64Round(0, value);
+    return acc * XXH64_PRIME_1 + XXH64_PRIME_4;
+}
+
+/**
+ *@brief Returns the checksum of the file at filePath as a lowercase hex string.
+ *
+ *@return The checksum, or an empty string if the file could not be read.
+ */
+std::string FileChecksum::compute(const std::string &filePath, Algorithm algorithm)
+{
+    std::string checksum{};
+    struct stat fileStat;
+    int         fd = open(filePath.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        return checksum;
+    }
+
+    if (fstat(fd, &fileStat) == 0)
+    {
+        size_t   size = fileStat.st_size;
+        uint8_t *data = nullptr;
+
+        /* mmap does not accept empty files, but they still have a checksum. */
+        if (size > 0)
+        {
+            void *mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (mapping != MAP_FAILED)
+            {
+                data = (uint8_t *)mapping;
+                madvise(mapping, size, MADV_SEQUENTIAL);
+            }
+        }
+
+        if (size == 0 || data != nullptr)
+        {
+            checksum = compute(data, size, algorithm);
+        }
+
+        if (data != nullptr)
+        {
+            munmap(data, size);
+        }
+    }
+
+    close(fd);
+
+    return checksum;
+}
+
+/**
+ *@brief Returns the checksum of the size bytes at data as a lowercase hex string. Used for
+ *files that are already mapped, such as the ELF libelf has open.
+ */
+std::string FileChecksum::compute(const uint8_t *data, size_t size, Algorithm algorithm)
+{
+    std::string checksum{};
+
+    switch (algorithm)
+    {
+        case ALGORITHM_XXH64:
+            checksum = xxh64ToHex(data, size);
+            break;
+        case ALGORITHM_MD5:
+        default:
+            checksum = md5ToHex(data, size);
+            break;
+    }
+
+    return checksum;
+}
+
+/**
+ *@brief Returns the name stored in the database for algorithm.
+ */
+const char *FileChecksum::getAlgorithmName(Algorithm algorithm)
+{
+    switch (algorithm)
+    {
+        case ALGORITHM_XXH64:
+            return "xxh64";
+        case ALGORITHM_MD5:
+        default:
+            return "md5";
+    }
+}
+
+/**
+ *@brief Parses an algorithm name as returned by getAlgorithmName.
+ *
+ *@return true if name is a known algorithm. algorithm is left untouched otherwise.
+ */
+bool FileChecksum::getAlgorithmFromName(const std::string &name, Algorithm &algorithm)
+{
+    bool found = true;
+
+    if (name == getAlgorithmName(ALGORITHM_MD5))
+    {
+        algorithm = ALGORITHM_MD5;
+    }
+    else if (name == getAlgorithmName(ALGORITHM_XXH64))
+    {
+        algorithm = ALGORITHM_XXH64;
+    }
+    else
+    {
+        found = false;
+    }
+
+    return found;
+}
+
+std::string FileChecksum::md5ToHex(const uint8_t *data, size_t length)
+{
+    std::ostringstream hex{};
+    unsigned char      digest[EVP_MAX_MD_SIZE];
+    unsigned int       digestLength = 0;
+    EVP_MD_CTX        *context      = EVP_MD_CTX_new();
+    bool               ok           = context != NULL && EVP_DigestInit_ex(context, EVP_md5(), NULL) == 1;
+
+    for (size_t offset = 0; ok && offset < length; offset += FILE_CHECKSUM_CHUNK_SIZE)
+    {
+        size_t chunkSize = length - offset < FILE_CHECKSUM_CHUNK_SIZE ? length - offset : FILE_CHECKSUM_CHUNK_SIZE;
+
+        ok               = EVP_DigestUpdate(context, data + offset, chunkSize) == 1;
+    }
+
+    if (ok && EVP_DigestFinal_ex(context, digest, &digestLength) == 1)
+    {
+        for (unsigned int i = 0; i < digestLength; i++)
+        {
+            // Ensure that we fill with zeroes. Otherwise our hash string will be missing zeroes.
+            hex << std::setfill('0') << std::setw(2) << std::right << std::hex << (unsigned int)digest[i];
+        }
+    }
+
+    EVP_MD_CTX_free(context);
+
+    return hex.str();
+}
+
+std::string FileChecksum::xxh64ToHex(const uint8_t *data, size_t length)
+{
+    std::ostringstream hex{};
+
+    hex << std::setfill('0') << std::setw(16) << std::right << std::hex << xxh64(data, length, 0);
+
+    return hex.str();
+}
+
+/**
+ *@brief The 64-bit xxHash of data, as specified in https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md.
+ */
+uint64_t FileChecksum::xxh64(const uint8_t *data, size_t length, uint64_t seed)
+{
+    const uint8_t *p   = data;
+    const uint8_t *end = data + length;
+    uint64_t       hash;
+
+    if (length >= 32)
+    {
+        const uint8_t *limit = end - 32;
+        uint64_t       acc1  = seed + XXH64_PRIME_1 + XXH64_PRIME_2;
+        uint64_t       acc2  = seed + XXH64_PRIME_2;
+        uint64_t       acc3  = seed;
+        uint64_t       acc4  = seed - XXH64_PRIME_1;
+
+        do
+        {
+            acc1  = xxh64Round(acc1, xxh64Read64(p));
+            acc2  = xxh64Round(acc2, xxh64Read64(p + 8));
+            acc3  = xxh64Round(acc3, xxh64Read64(p + 16));
+            acc4  = xxh64Round(acc4, xxh64Read64(p + 24));
+            p    += 32;
+        } while (p <= limit);
+
+        hash = xxh64Rotl(acc1, 1) + xxh64Rotl(acc2, 7) + xxh64Rotl(acc3, 12) + xxh64Rotl(acc4, 18);
+        hash = xxh64MergeRound(hash, acc1);
+        hash = xxh64MergeRound(hash, acc2);
+        hash = xxh64MergeRound(hash, acc3);
+        hash = xxh64MergeRound(hash, acc4);
+    }
+    else
+    {
+        hash = seed + XXH64_PRIME_5;
+    }
+
+    hash += (uint64_t)length;
+
+    while (p + 8 <= end)
+    {
+        hash ^= xxh64Round(0, xxh64Read64(p));
+        hash  = xxh64Rotl(hash, 27) * XXH64_PRIME_1 + XXH64_PRIME_4;
+        p    += 8;
+    }
+
+    if (p + 4 <= end)
+    {
+        hash ^= (uint64_t)xxh64Read32(p) * XXH64_PRIME_1;
+        hash  = xxh64Rotl(hash, 23) * XXH64_PRIME_2 + XXH64_PRIME_3;
+        p    += 4;
+    }
+
+    while (p < end)
+    {
+        hash ^= (*p) * XXH64_PRIME_5;
+        hash  = xxh64Rotl(hash, 11) * XXH64_PRIME_1;
+        p++;
+    }
+
+    hash ^= hash >> 33;
+    hash *= XXH64_PRIME_2;
+    hash ^= hash >> 29;
+    hash *= XXH64_PRIME_3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
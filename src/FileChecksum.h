@@ -0,0 +1,45 @@
+/*
+ * FileChecksum.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_FILECHECKSUM_H_
+#define SRC_FILECHECKSUM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+/**
+ *@brief Computes the checksums juicer stores for the ELF and its artifacts.
+ *
+ *Files are memory-mapped and fed to the digest as they are read, so hashing a large
+ *ELF does not need a heap copy of it.
+ *
+ *MD5 is the default because existing databases and tools expect it. XXH64 is a
+ *non-cryptographic hash that is much cheaper to compute; it is good enough to tell
+ *whether a file changed, but not to guard against tampering.
+ */
+class FileChecksum
+{
+   public:
+    enum Algorithm
+    {
+        ALGORITHM_MD5,
+        ALGORITHM_XXH64
+    };
+
+    static std::string compute(const std::string &filePath, Algorithm algorithm);
+    static std::string compute(const uint8_t *data, size_t size, Algorithm algorithm);
+    static const char *getAlgorithmName(Algorithm algorithm);
+    static bool        getAlgorithmFromName(const std::string &name, Algorithm &algorithm);
+    static uint64_t    xxh64(const uint8_t *data, size_t length, uint64_t seed);
+
+   private:
+    static std::string md5ToHex(const uint8_t *data, size_t length);
+    static std::string xxh64ToHex(const uint8_t *data, size_t length);
+};
+
+#endif /* SRC_FILECHECKSUM_H_ */
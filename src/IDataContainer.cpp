@@ -15,6 +15,41 @@ IDataContainer::~IDataContainer() {}
 
 IDataContainer::IDataContainer() {}
 
+/**
+ *@brief Tells Juicer's incremental mode whether the elf called name was already written
+ *with the given checksum, in which case it does not need to be juiced again.
+ *
+ *Containers that cannot answer this return false, so every elf is always juiced.
+ */
+bool            IDataContainer::hasElf(const std::string& name, const std::string& checksum, const std::string& algorithm) { return false; }
+
+/**
+ *@brief Finishes writing to the container. Containers that write as they go have nothing
+ *left to do and return JUICER_OK.
+ */
+int             IDataContainer::close(void) { return JUICER_OK; }
+
+/**
+ *@brief Starts writing inModule while Juicer is still reading it. Juicer calls writeNewSymbols
+ *after every CU it reads, and endElf once it is done. See Juicer::setPipeline.
+ *
+ *Containers that can only write a whole elf at once leave all three to these defaults,
+ *which write inModule in endElf.
+ */
+int             IDataContainer::beginElf(ElfFile& inModule) { return JUICER_OK; }
+
+/**
+ *@brief Takes the symbols that were added to inModule since the last call, with their fields
+ *and enumerations. Containers that stream write them on their own time.
+ */
+int             IDataContainer::writeNewSymbols(ElfFile& inModule) { return JUICER_OK; }
+
+/**
+ *@brief Finishes what beginElf started. complete is false if Juicer failed to read inModule,
+ *in which case nothing of it should be kept.
+ */
+int             IDataContainer::endElf(ElfFile& inModule, bool complete) { return complete ? write(inModule) : JUICER_OK; }
+
 IDataContainer *IDataContainer::Create(IDataContainer_Type_t containerType, const char *initSpec, ...)
 {
     IDataContainer *container = nullptr;
@@ -45,18 +80,21 @@ IDataContainer *IDataContainer::Create(IDataContainer_Type_t containerType, cons
     va_end(args_copy);
     va_end(args);
 
-    logger.logDebug("IDC initialization string = '%s'", initString.c_str());
+    JUICER_LOG_DEBUG(logger, "IDC initialization string = '%s'", initString.c_str());
 
     switch (containerType)
     {
         case IDC_TYPE_SQLITE:
+        case IDC_TYPE_SQLITE_IN_MEMORY:
         {
-            int rc;
+            int       rc;
+            SQLiteDB *sqliteDB = new SQLiteDB();
 
-            logger.logDebug("Creating SQLiteDB IDC.");
+            JUICER_LOG_DEBUG(logger, "Creating SQLiteDB IDC.");
 
-            container = new SQLiteDB();
+            sqliteDB->setBuildInMemory(IDC_TYPE_SQLITE_IN_MEMORY == containerType);
 
+            container = sqliteDB;
             rc        = container->initialize(initString);
             if (rc < 0)
             {
@@ -65,7 +103,7 @@ IDataContainer *IDataContainer::Create(IDataContainer_Type_t containerType, cons
                 container = nullptr;
             }
 
-            logger.logDebug("Created SQLiteDB IDC.");
+            JUICER_LOG_DEBUG(logger, "Created SQLiteDB IDC.");
 
             break;
         }
@@ -16,8 +16,10 @@
 
 typedef enum
 {
-    IDC_TYPE_SQLITE = 0,
-    IDC_TYPE_CCDD   = 1,
+    IDC_TYPE_SQLITE           = 0,
+    IDC_TYPE_CCDD             = 1,
+    /* A SQLiteDB that is built in memory and only written to its file when it is closed. */
+    IDC_TYPE_SQLITE_IN_MEMORY = 2,
 } IDataContainer_Type_t;
 
 /**
@@ -31,6 +33,11 @@ class IDataContainer
    public:
     virtual ~IDataContainer();
     virtual int            write(ElfFile& inModule) = 0;
+    virtual bool           hasElf(const std::string& name, const std::string& checksum, const std::string& algorithm);
+    virtual int            close(void);
+    virtual int            beginElf(ElfFile& inModule);
+    virtual int            writeNewSymbols(ElfFile& inModule);
+    virtual int            endElf(ElfFile& inModule, bool complete);
     static IDataContainer* Create(IDataContainer_Type_t containerType, const char* initSpec, ...);
 
    protected:
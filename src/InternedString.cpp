@@ -0,0 +1,116 @@
+/*
+ * InternedString.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "InternedString.h"
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+namespace
+{
+/**
+ * Most values were interned by an earlier CU already, so looking them up only takes the
+ * mutex shared, and the --jobs workers do not wait for each other. Adding a value takes it
+ * exclusively.
+ */
+struct StringPool
+{
+    std::shared_timed_mutex         mutex;
+    /* Elements of an unordered_set do not move when it rehashes, so handles stay valid. */
+    std::unordered_set<std::string> strings;
+    size_t                          bytes{0};
+};
+
+/* Constructed on first use, so InternedStrings with static storage duration are safe. */
+StringPool &getPool()
+{
+    static StringPool *pool = new StringPool();
+    return *pool;
+}
+
+const std::string *intern(const std::string &value)
+{
+    StringPool &pool = getPool();
+
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(pool.mutex);
+
+        auto                                      it = pool.strings.find(value);
+
+        if (it != pool.strings.end())
+        {
+            return &*it;
+        }
+    }
+
+    /* Another thread may have added value since the lookup, which insert takes care of. */
+    std::lock_guard<std::shared_timed_mutex> lock(pool.mutex);
+
+    auto                                     inserted = pool.strings.insert(value);
+
+    if (inserted.second)
+    {
+        pool.bytes += value.size() + 1;
+    }
+
+    return &*inserted.first;
+}
+}  // namespace
+
+InternedString::InternedString()
+{
+    static const std::string *empty = intern(std::string{});
+    value                           = empty;
+}
+
+InternedString::InternedString(const std::string &inValue) : value{intern(inValue)} {}
+
+InternedString::InternedString(const char *inValue) : value{intern(std::string{inValue})} {}
+
+/**
+ *@brief Looks value up without adding it to the pool.
+ *
+ *@return true and sets interned if value has been interned before. If it has not,
+ *no handle can be equal to it, which lets name lookups fail without growing the pool.
+ */
+bool InternedString::find(const std::string &value, InternedString &interned)
+{
+    StringPool                               &pool = getPool();
+    std::shared_lock<std::shared_timed_mutex> lock(pool.mutex);
+
+    auto                                      it    = pool.strings.find(value);
+    bool                                      found = it != pool.strings.end();
+
+    if (found)
+    {
+        interned.value = &*it;
+    }
+
+    return found;
+}
+
+/**
+ *@return The number of distinct strings interned so far.
+ */
+size_t InternedString::getPoolSize(void)
+{
+    StringPool                               &pool = getPool();
+    std::shared_lock<std::shared_timed_mutex> lock(pool.mutex);
+
+    return pool.strings.size();
+}
+
+/**
+ *@return The number of characters, terminators included, of the distinct strings interned so far.
+ */
+size_t InternedString::getPoolBytes(void)
+{
+    StringPool                               &pool = getPool();
+    std::shared_lock<std::shared_timed_mutex> lock(pool.mutex);
+
+    return pool.bytes;
+}
@@ -0,0 +1,59 @@
+/*
+ * InternedString.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_INTERNEDSTRING_H_
+#define SRC_INTERNEDSTRING_H_
+
+#include <stddef.h>
+
+#include <functional>
+#include <string>
+
+/**
+ *@brief Handle to a string in a process-wide pool that holds every distinct value once.
+ *
+ *Type names, field names and source paths repeat across every CU of every elf. Interning
+ *them stores each value once, and makes a handle the size of a pointer. Two handles are
+ *equal exactly when their strings are, so comparing and hashing them never looks at
+ *the characters.
+ *
+ *@note The pool is never shrunk, so a handle and the string it refers to stay valid until
+ *the process exits. Interning is thread-safe.
+ */
+class InternedString
+{
+   public:
+    InternedString();
+    explicit InternedString(const std::string &value);
+    explicit InternedString(const char *value);
+
+    static bool        find(const std::string &value, InternedString &interned);
+
+    const std::string &str() const { return *value; }
+    const char        *c_str() const { return value->c_str(); }
+
+    bool               operator==(const InternedString &other) const { return value == other.value; }
+    bool               operator!=(const InternedString &other) const { return value != other.value; }
+
+    static size_t      getPoolSize(void);
+    static size_t      getPoolBytes(void);
+
+   private:
+    friend struct std::hash<InternedString>;
+
+    const std::string *value;
+};
+
+namespace std
+{
+template <>
+struct hash<InternedString>
+{
+    size_t operator()(const InternedString &interned) const { return std::hash<const std::string *>()(interned.value); }
+};
+}  // namespace std
+
+#endif /* SRC_INTERNEDSTRING_H_ */
@@ -36,18 +36,22 @@
 #include <ctype.h>
 #include <errno.h>
 #include <libelf.h>
+#include <limits.h>
 #include <memory.h>
-#include <openssl/md5.h>
 #include <string.h>
 
+#include <algorithm>
 #include <cmath>
+#include <condition_variable>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <numeric>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "Artifact.h"
@@ -55,6 +59,7 @@
 #include "Enumeration.h"
 #include "Field.h"
 #include "IDataContainer.h"
+#include "Stats.h"
 #include "Symbol.h"
 #include "Variable.h"
 
@@ -93,12 +98,12 @@ DefineMacro Juicer::getDefineMacro(Dwarf_Half macro_operator, Dwarf_Macro_Contex
         {
             /*  End of these DWARF_MACRO ops */
 
-            logger.logDebug("End of these DWARF_MACRO ops");
+            JUICER_LOG_DEBUG(logger, "End of these DWARF_MACRO ops");
             break;
         }
         case DW_MACRO_end_file:
         {
-            logger.logDebug("DW_MACRO_end_file\n");
+            JUICER_LOG_DEBUG(logger, "DW_MACRO_end_file\n");
             break;
         }
         case DW_MACRO_define:
@@ -112,9 +117,7 @@ DefineMacro Juicer::getDefineMacro(Dwarf_Half macro_operator, Dwarf_Macro_Contex
             }
             else
             {
-                auto macro = getDefineMacroFromString(macro_string);
-                outMacro   = macro;
-                elf.addDefineMacro(macro);
+                outMacro = getDefineMacroFromString(macro_string);
             }
 
             break;
@@ -129,9 +132,7 @@ DefineMacro Juicer::getDefineMacro(Dwarf_Half macro_operator, Dwarf_Macro_Contex
             }
             else
             {
-                auto macro = getDefineMacroFromString(macro_string);
-                outMacro   = macro;
-                elf.addDefineMacro(macro);
+                outMacro = getDefineMacroFromString(macro_string);
             }
 
             break;
@@ -163,9 +164,79 @@ DefineMacro Juicer::getDefineMacro(Dwarf_Half macro_operator, Dwarf_Macro_Contex
         }
         case DW_MACRO_import:
         {
-            res = dwarf_get_macro_import(mac_context, i, &offset, &error);
+            /* Imports are resolved by readMacroOps, which caches the units they refer to. */
+            break;
+        }
+        case DW_MACRO_import_sup:
+        {
+            logger.logWarning("DW_MACRO_start_file is not supported at the moment");
+
+            break;
+        }
+    } /*  End switch(macro_operator) */
+    return outMacro;
+}
 
-            if (offset == 0)
+/**
+ *@brief Appends the macros defined by the first opsCount ops of macroContext to macros,
+ *including those of the units the ops import.
+ *
+ *@param skipUnits Imported units whose offset is already in this set are skipped, and the
+ *offsets of the others are added to it. Pass nullptr to read every import, which is needed
+ *when the macros are decoded for macroUnitCache.
+ */
+void Juicer::readMacroOps(ElfFile &elf, Dwarf_Macro_Context macroContext, Dwarf_Unsigned opsCount, Dwarf_Die cu_die, Dwarf_Error &error,
+                          std::vector<DefineMacro> &macros, std::unordered_set<Dwarf_Unsigned> *skipUnits)
+{
+    /*  Access to the macro operations, 0 to macro_ops_count_out-1
+        Where the last of these will have macro_operator 0 (which appears
+        in the ops data and means end-of-ops).
+        op_start_section_offset is the section offset of
+        the macro operator (which is a single unsigned byte,
+        and is followed by the macro operand data). */
+    //        	int dwarf_get_macro_op(Dwarf_Macro_Context /*macro_context*/,
+    //        	    Dwarf_Unsigned   /*op_number*/,
+    //        	    Dwarf_Unsigned * /*op_start_section_offset*/,
+    //        	    Dwarf_Half     * /*macro_operator*/,
+    //        	    Dwarf_Half     * /*forms_count*/,
+    //        	    const Dwarf_Small **  /*formcode_array*/,
+    //        	    Dwarf_Error    * /*error*/);
+    //
+    //        	int dwarf_get_macro_defundef(Dwarf_Macro_Context /*macro_context*/,
+    //        	    Dwarf_Unsigned   /*op_number*/,
+    //        	    Dwarf_Unsigned * /*line_number*/,
+    //        	    Dwarf_Unsigned * /*index*/,
+    //        	    Dwarf_Unsigned * /*offset*/,
+    //        	    Dwarf_Half     * /*forms_count*/,
+    //        	    const char    ** /*macro_string*/,
+    //        	    Dwarf_Error    * /*error*/);
+
+    for (Dwarf_Unsigned i = 0; i < opsCount; i++)
+    {
+        Dwarf_Unsigned     section_offset = 0;
+        Dwarf_Half         macro_operator = 0;
+        Dwarf_Half         forms_count    = 0;
+        const Dwarf_Small *formcode_array = 0;
+        Dwarf_Unsigned     line_number    = 0;
+        Dwarf_Unsigned     index          = 0;
+        Dwarf_Unsigned     offset         = 0;
+        const char        *macro_string   = 0;
+
+        int                res = dwarf_get_macro_op(macroContext, i, &section_offset, &macro_operator, &forms_count, &formcode_array, &error);
+
+        if (res == DW_DLV_ERROR)
+        {
+            logger.logError("Error in dwarf_get_macro_op. errno=%u %s", dwarf_errno(error), dwarf_errmsg(error));
+        }
+        else if (macro_operator == DW_MACRO_import)
+        {
+            res = dwarf_get_macro_import(macroContext, i, &offset, &error);
+
+            if (res != DW_DLV_OK)
+            {
+                logger.logError("Error in dwarf_get_macro_import. errno=%u %s", dwarf_errno(error), dwarf_errmsg(error));
+            }
+            else if (offset == 0)
             {
                 /**
                  * @todo This should be re-visited.
@@ -173,70 +244,121 @@ DefineMacro Juicer::getDefineMacro(Dwarf_Half macro_operator, Dwarf_Macro_Contex
                  *
                  */
                 logger.logWarning("Found offset of zero for DW_MACRO_import. Ignoring macro Entry.");
-                return outMacro;
             }
-            if (res != DW_DLV_OK)
+            else if (skipUnits != nullptr && !skipUnits->insert(offset).second)
             {
-                /**
-                 * @todo Should be returning the actual return code rather than using a string this outMacro...
-                 */
-                return outMacro;
+                /* Every CU that includes the same headers imports the same units. Their macros were added when the unit was first imported. */
+                JUICER_LOG_DEBUG(logger, "Macro unit at offset 0x%llx was already imported.", offset);
+                Stats::count(STATS_COUNTER_MACRO_UNITS_REUSED);
             }
             else
             {
-                Dwarf_Unsigned      mac_import_version;
-                Dwarf_Macro_Context mac_import_context;
-                Dwarf_Unsigned      mac_import_unit_offset;
-                Dwarf_Unsigned      mac_import_ops_count;
-                Dwarf_Unsigned      mac_import_ops_data_length;
-                int                 res = dwarf_get_macro_context_by_offset(cu_die, offset, &mac_import_version, &mac_import_context, &mac_import_ops_count,
-                                                                            &mac_import_ops_data_length, &error);
-
-                logger.logDebug("mac_import_ops_count:%d\n", mac_import_ops_count);
-
-                logger.logDebug("mac_import_ops_data_length:%d\n", mac_import_ops_data_length);
-                for (int i = 0; i < mac_import_ops_count; i++)
-                {
-                    Dwarf_Unsigned     section_offset = 0;
-                    Dwarf_Half         macro_operator = 0;
-                    Dwarf_Half         forms_count    = 0;
-                    const Dwarf_Small *formcode_array = 0;
-                    Dwarf_Unsigned     line_number    = 0;
-                    Dwarf_Unsigned     index          = 0;
-                    Dwarf_Unsigned     offset         = 0;
-                    const char        *macro_string   = 0;
-
-                    res = dwarf_get_macro_op(mac_import_context, i, &section_offset, &macro_operator, &forms_count, &formcode_array, &error);
-                    if (res == DW_DLV_ERROR)
-                    {
-                        /**
-                         * @todo Should be returning the actual return code rather than using a string this outMacro...
-                         */
-                        return outMacro;
-                    }
-
-                    logger.logDebug("Found macro string:%s\n", macro_string);
-                    auto newMacro =
-                        getDefineMacro(macro_operator, mac_import_context, i, line_number, index, offset, macro_string, forms_count, error, cu_die, elf);
+                const std::vector<DefineMacro> *unitMacros = getMacroUnit(elf, offset, cu_die, error);
 
-                    if (!newMacro.getName().empty())
-                    {
-                        elf.addDefineMacro(newMacro);
-                        logger.logDebug("Found imported macro:%s", newMacro.getName());
-                    }
+                if (unitMacros != nullptr)
+                {
+                    macros.insert(macros.end(), unitMacros->begin(), unitMacros->end());
                 }
             }
+        }
+        else
+        {
+            auto newMacro = getDefineMacro(macro_operator, macroContext, i, line_number, index, offset, macro_string, forms_count, error, cu_die, elf);
 
-            break;
+            if (!newMacro.getName().empty())
+            {
+                macros.push_back(std::move(newMacro));
+            }
         }
-        case DW_MACRO_import_sup:
+    }
+}
+
+/**
+ *@brief Returns the macros of the .debug_macro unit at offset, including those of the units
+ *it imports. Each unit is decoded once per ELF and then served from macroUnitCache.
+ *
+ *@return The macros of the unit, or nullptr if it could not be read.
+ */
+const std::vector<DefineMacro> *Juicer::getMacroUnit(ElfFile &elf, Dwarf_Unsigned offset, Dwarf_Die cu_die, Dwarf_Error &error)
+{
+    const std::vector<DefineMacro> *unitMacros = macroUnitCache->lookup(offset);
+
+    if (unitMacros != nullptr)
+    {
+        Stats::count(STATS_COUNTER_MACRO_UNITS_REUSED);
+    }
+    else
+    {
+        Dwarf_Unsigned      mac_import_version;
+        Dwarf_Macro_Context mac_import_context;
+        Dwarf_Unsigned      mac_import_ops_count;
+        Dwarf_Unsigned      mac_import_ops_data_length;
+        int res = dwarf_get_macro_context_by_offset(cu_die, offset, &mac_import_version, &mac_import_context, &mac_import_ops_count, &mac_import_ops_data_length,
+                                                    &error);
+
+        if (res == DW_DLV_OK)
         {
-            logger.logWarning("DW_MACRO_start_file is not supported at the moment");
+            std::vector<DefineMacro> decodedMacros{};
 
-            break;
+            JUICER_LOG_DEBUG(logger, "mac_import_ops_count:%d\n", mac_import_ops_count);
+
+            JUICER_LOG_DEBUG(logger, "mac_import_ops_data_length:%d\n", mac_import_ops_data_length);
+
+            readMacroOps(elf, mac_import_context, mac_import_ops_count, cu_die, error, decodedMacros, nullptr);
+
+            dwarf_dealloc_macro_context(mac_import_context);
+
+            Stats::count(STATS_COUNTER_MACRO_UNITS_READ);
+            unitMacros = &macroUnitCache->insert(offset, std::move(decodedMacros));
         }
-    } /*  End switch(macro_operator) */
-    return outMacro;
+        else if (res == DW_DLV_ERROR)
+        {
+            logger.logError("Error in dwarf_get_macro_context_by_offset. errno=%u %s", dwarf_errno(error), dwarf_errmsg(error));
+        }
+    }
+
+    return unitMacros;
+}
+
+/**
+ *@brief Adds the macros of the CU of cu_die to elf.
+ *
+ *@note Only called when macros are enabled with setMacros. Builds with -g3 carry millions of
+ *macro ops, which makes this the most expensive part of reading a CU.
+ */
+void Juicer::readMacros(ElfFile &elf, Dwarf_Die cu_die, Dwarf_Error &error)
+{
+    Stats::Timer        macroTimer{STATS_PHASE_MACROS};
+
+    Dwarf_Unsigned      mac_version;
+    Dwarf_Macro_Context mac_context;
+    Dwarf_Unsigned      mac_unit_offset;
+    Dwarf_Unsigned      mac_ops_count;
+    Dwarf_Unsigned      mac_ops_data_length;
+
+    int mac_res = dwarf_get_macro_context(cu_die, &mac_version, &mac_context, &mac_unit_offset, &mac_ops_count, &mac_ops_data_length, &error);
+
+    if (mac_res == DW_DLV_OK)
+    {
+        std::vector<DefineMacro> macros{};
+
+        readMacroOps(elf, mac_context, mac_ops_count, cu_die, error, macros, &importedMacroUnits);
+
+        dwarf_dealloc_macro_context(mac_context);
+
+        for (auto &&macro : macros)
+        {
+            elf.addDefineMacro(std::move(macro));
+        }
+    }
+    else if (mac_res == DW_DLV_ERROR)
+    {
+        logger.logError("Error in dwarf_get_macro_context. errno=%u %s", dwarf_errno(error), dwarf_errmsg(error));
+    }
+    else
+    {
+        JUICER_LOG_DEBUG(logger, "CU has no macro information. Was it built with -g3?");
+    }
 }
 
 /**
@@ -257,22 +379,15 @@ int Juicer::readCUList(ElfFile &elf, Dwarf_Debug dbg, Dwarf_Error &error)
 
     while (1)
     {
-        Dwarf_Die no_die = 0;
         Dwarf_Die cu_die = 0;
         int       res    = DW_DLV_ERROR;
 
         ++cu_number;
 
-        logger.logDebug("Reading CU %u.", cu_number);
+        JUICER_LOG_DEBUG(logger, "Reading CU %u.", cu_number);
 
         DisplayDie(cu_die, 0);
 
-        Dwarf_Unsigned      mac_version;
-        Dwarf_Macro_Context mac_context;
-        Dwarf_Unsigned      mac_unit_offset;
-        Dwarf_Unsigned      mac_ops_count;
-        Dwarf_Unsigned      mac_ops_data_length;
-
         res = dwarf_next_cu_header(dbg, &cu_header_length, &version_stamp, &abbrev_offset, &address_size, &next_cu_header, &error);
 
         if (res == DW_DLV_ERROR)
@@ -289,143 +404,265 @@ int Juicer::readCUList(ElfFile &elf, Dwarf_Debug dbg, Dwarf_Error &error)
 
         if (JUICER_OK == return_value)
         {
-            /* The CU will have a single sibling, a cu_die. */
-            res         = dwarf_siblingof(dbg, no_die, &cu_die, &error);
+            Logger::setContextCU(cu_number);
+            return_value = readCU(elf, dbg, error);
+        }
 
-            int mac_res = dwarf_get_macro_context(cu_die, &mac_version, &mac_context, &mac_unit_offset, &mac_ops_count, &mac_ops_data_length, &error);
+        if (JUICER_OK == return_value && isPipelined())
+        {
+            return_value = idc->writeNewSymbols(elf);
+        }
+    }
 
-            Dwarf_Unsigned     section_offset = 0;
-            Dwarf_Half         macro_operator = 0;
-            Dwarf_Half         forms_count    = 0;
-            const Dwarf_Small *formcode_array = 0;
+    Logger::clearContext();
 
-            if (mac_res == 0)
-            {
-                for (int i = 0; i < mac_ops_count; i++)
-                {
-                    Dwarf_Unsigned     section_offset = 0;
-                    Dwarf_Half         macro_operator = 0;
-                    Dwarf_Half         forms_count    = 0;
-                    const Dwarf_Small *formcode_array = 0;
-                    Dwarf_Unsigned     line_number    = 0;
-                    Dwarf_Unsigned     index          = 0;
-                    Dwarf_Unsigned     offset         = 0;
-                    const char        *macro_string   = 0;
-
-                    res = dwarf_get_macro_op(mac_context, i, &section_offset, &macro_operator, &forms_count, &formcode_array, &error);
-
-                    if (res == DW_DLV_ERROR)
-                    {
-                        logger.logError("Error in dwarf_get_macro_op. errno=%u %s", dwarf_errno(error), dwarf_errmsg(error));
-                    }
-                    else
-                    {
-                        auto newMacro =
-                            getDefineMacro(macro_operator, mac_context, i, line_number, index, offset, macro_string, forms_count, error, cu_die, elf);
+    return return_value;
+}
 
-                        if (!newMacro.getName().empty())
-                        {
-                            elf.addDefineMacro(newMacro);
-                        }
-                    }
-                }
-            }
-            else
-            {
-                logger.logError("Error in dwarf_get_macro_context. errno=%u %s", dwarf_errno(error), dwarf_errmsg(error));
-            }
+/**
+ *@brief Reads the CU that dbg's CU cursor currently sits on, which is wherever the last
+ *dwarf_next_cu_header call left it, into elf.
+ *
+ *@return JUICER_OK if the CU die and all of its children were read successfully.
+ */
+int Juicer::readCU(ElfFile &elf, Dwarf_Debug dbg, Dwarf_Error &error)
+{
+    Dwarf_Die no_die       = 0;
+    Dwarf_Die cu_die       = 0;
+    int       res          = DW_DLV_ERROR;
+    int       return_value = JUICER_OK;
 
-            /*  Access to the macro operations, 0 to macro_ops_count_out-1
-                Where the last of these will have macro_operator 0 (which appears
-                in the ops data and means end-of-ops).
-                op_start_section_offset is the section offset of
-                the macro operator (which is a single unsigned byte,
-                and is followed by the macro operand data). */
-            //        	int dwarf_get_macro_op(Dwarf_Macro_Context /*macro_context*/,
-            //        	    Dwarf_Unsigned   /*op_number*/,
-            //        	    Dwarf_Unsigned * /*op_start_section_offset*/,
-            //        	    Dwarf_Half     * /*macro_operator*/,
-            //        	    Dwarf_Half     * /*forms_count*/,
-            //        	    const Dwarf_Small **  /*formcode_array*/,
-            //        	    Dwarf_Error    * /*error*/);
-            //
-            //        	int dwarf_get_macro_defundef(Dwarf_Macro_Context /*macro_context*/,
-            //        	    Dwarf_Unsigned   /*op_number*/,
-            //        	    Dwarf_Unsigned * /*line_number*/,
-            //        	    Dwarf_Unsigned * /*index*/,
-            //        	    Dwarf_Unsigned * /*offset*/,
-            //        	    Dwarf_Half     * /*forms_count*/,
-            //        	    const char    ** /*macro_string*/,
-            //        	    Dwarf_Error    * /*error*/);
+    if (JUICER_OK == return_value)
+    {
+        /* The CU will have a single sibling, a cu_die. */
+        res         = dwarf_siblingof(dbg, no_die, &cu_die, &error);
 
-            if (res == DW_DLV_ERROR)
-            {
-                logger.logError("Error in dwarf_siblingof on CU die. errno=%u %s", dwarf_errno(error), dwarf_errmsg(error));
-                return_value = JUICER_ERROR;
-            }
-            else if (res == DW_DLV_NO_ENTRY)
-            {
-                /* Impossible case. */
-                logger.logError("no entry! in dwarf_siblingof on CU die. errno=%u %s", dwarf_errno(error), dwarf_errmsg(error));
-                return_value = JUICER_ERROR;
-            }
+        Stats::count(STATS_COUNTER_CUS);
+
+        if (macros && res == DW_DLV_OK)
+        {
+            readMacros(elf, cu_die, error);
         }
 
-        if (JUICER_OK == return_value)
+        if (res == DW_DLV_ERROR)
+        {
+            logger.logError("Error in dwarf_siblingof on CU die. errno=%u %s", dwarf_errno(error), dwarf_errmsg(error));
+            return_value = JUICER_ERROR;
+        }
+        else if (res == DW_DLV_NO_ENTRY)
         {
-            char       **filePaths = nullptr;
-            Dwarf_Signed fileCount = 0;
+            /* Impossible case. */
+            logger.logError("no entry! in dwarf_siblingof on CU die. errno=%u %s", dwarf_errno(error), dwarf_errmsg(error));
+            return_value = JUICER_ERROR;
+        }
+    }
 
-            /**
-             * According to 6.2 Line Number Information in DWARF 4:
-             * Line number information generated for a compilation unit is represented in the .debug_line
-             * section of an object file and is referenced by a corresponding compilation unit debugging
-             * information entry (see Section 3.1.1) in the .debug_info section.
-             * This is why we are using dwarf_siblingof_b  instead of dwarf_siblingof and setting
-             * the is_info to true.
-             *
-             * We are using a new Dwarf_Die because if we use cur_die, we segfault.
-             *
-             * My theory on this is that even though when we initially call dwarf_siblingof on
-             * cur_die and as we read different kinds of tags/attributes(in particular type-related),
-             * the libdwarf library is modifying the die when I call dwarf_srcfiles on it.
-             *
-             * Notice that in https://penguin.windhoverlabs.lan/gitlab/ground-systems/libdwarf/-/blob/main/libdwarf/libdwarf/dwarf_die_deliv.c#L1365
-             *
-             * This is just a a theory, however. In the future we may revisit this
-             * to figure out the root cause of this.
-             *
-             */
-            // TODO: Move logic to the place where we load the CU die for the first time
-            // and make filePaths a field that all methods can access. Then, I think,
-            // we can index into that array with file_path_numbr and don't have to iterate through the
-            // entire list every time we find a new symbol.
-            Dwarf_Die    src_die   = 0;
-            int          sres      = dwarf_siblingof_b(dbg, NULL, true, &src_die, &error);
-
-            if (sres == DW_DLV_OK)
-            {
-                dwarf_srcfiles(src_die, &filePaths, &fileCount, &error);
-            }
+    if (JUICER_OK == return_value)
+    {
+        char       **filePaths = nullptr;
+        Dwarf_Signed fileCount = 0;
+
+        /**
+         * According to 6.2 Line Number Information in DWARF 4:
+         * Line number information generated for a compilation unit is represented in the .debug_line
+         * section of an object file and is referenced by a corresponding compilation unit debugging
+         * information entry (see Section 3.1.1) in the .debug_info section.
+         * This is why we are using dwarf_siblingof_b  instead of dwarf_siblingof and setting
+         * the is_info to true.
+         *
+         * We are using a new Dwarf_Die because if we use cur_die, we segfault.
+         *
+         * My theory on this is that even though when we initially call dwarf_siblingof on
+         * cur_die and as we read different kinds of tags/attributes(in particular type-related),
+         * the libdwarf library is modifying the die when I call dwarf_srcfiles on it.
+         *
+         * Notice that in https://penguin.windhoverlabs.lan/gitlab/ground-systems/libdwarf/-/blob/main/libdwarf/libdwarf/dwarf_die_deliv.c#L1365
+         *
+         * This is just a a theory, however. In the future we may revisit this
+         * to figure out the root cause of this.
+         *
+         */
+        // TODO: Move logic to the place where we load the CU die for the first time
+        // and make filePaths a field that all methods can access. Then, I think,
+        // we can index into that array with file_path_numbr and don't have to iterate through the
+        // entire list every time we find a new symbol.
+        Dwarf_Die    src_die   = 0;
+        int          sres      = dwarf_siblingof_b(dbg, NULL, true, &src_die, &error);
+
+        if (sres == DW_DLV_OK)
+        {
+            dwarf_srcfiles(src_die, &filePaths, &fileCount, &error);
+        }
 
-            if (filePaths != nullptr)
+        if (filePaths != nullptr)
+        {
+            /* DW_AT_decl_file indexes the file list of the current CU only, so the previous
+             * CU's list is replaced instead of kept in front of. The paths repeat across CUs
+             * and are interned, so every Artifact made from them shares one copy. */
+            dbgSourceFiles.clear();
+
+            for (Dwarf_Signed i = 0; i < fileCount; i++)
             {
-                dbgSourceFiles.insert(dbgSourceFiles.begin(), filePaths, &filePaths[fileCount]);
+                dbgSourceFiles.emplace_back(filePaths[i]);
             }
-
-            return_value = getDieAndSiblings(elf, dbg, cu_die, 0);
         }
 
-        if (JUICER_OK != return_value)
+        return_value = getDieAndSiblings(elf, dbg, cu_die, 0);
+    }
+
+    if (JUICER_OK != return_value)
+    {
+        logger.logError("Error on siblings func");
+    }
+
+    dwarf_dealloc(dbg, cu_die, DW_DLA_DIE);
+
+    return return_value;
+}
+
+/**
+ *@brief Reads the CUs of elfFilePath with a pool of worker threads and merges their
+ *results into elf.
+ *
+ *libdwarf handles are not safe to share between threads, so every worker is its own
+ *Juicer with its own file descriptor and Dwarf_Debug. Workers claim CUs by index
+ *from a shared counter and read each one into a partial ElfFile of its own. Once
+ *all workers are done, the partials are merged into elf in CU order, which gives
+ *the same symbols, in the same order, as readCUList does.
+ *
+ *@param dbg The already initialized Dwarf_Debug of elfFilePath. It is only used to
+ *count the CUs.
+ */
+int Juicer::readCUListParallel(ElfFile &elf, std::string &elfFilePath, Dwarf_Debug dbg, Dwarf_Error &error)
+{
+    Dwarf_Unsigned cu_header_length = 0;
+    Dwarf_Half     version_stamp    = 0;
+    Dwarf_Unsigned abbrev_offset    = 0;
+    Dwarf_Half     address_size     = 0;
+    Dwarf_Unsigned next_cu_header   = 0;
+    unsigned int   cuCount          = 0;
+    unsigned int   workerCount      = 0;
+    int            return_value     = JUICER_OK;
+
+    while (dwarf_next_cu_header(dbg, &cu_header_length, &version_stamp, &abbrev_offset, &address_size, &next_cu_header, &error) == DW_DLV_OK)
+    {
+        cuCount++;
+    }
+
+    workerCount = std::min(jobs, cuCount);
+
+    logger.logInfo("Reading %u CUs with %u workers.", cuCount, workerCount);
+
+    std::atomic<unsigned int>             nextCU{0};
+    std::vector<std::unique_ptr<ElfFile>> partials(cuCount);
+    std::vector<int>                      cuResults(cuCount, JUICER_ERROR);
+    std::vector<Dwarf_Half>               cuDwarfVersions(cuCount, 0);
+    std::vector<std::thread>              workers{};
+
+    for (unsigned int i = 0; i < workerCount; i++)
+    {
+        workers.push_back(std::thread([&]() {
+            Juicer worker;
+
+            worker.setExtras(extras);
+            worker.setMacros(macros);
+            worker.setGroupNumber(groupNumber);
+            worker.setChecksumAlgorithm(checksumAlgorithm);
+            worker.checksumCache  = checksumCache;
+            worker.macroUnitCache = macroUnitCache;
+            worker.readClaimedCUs(elfFilePath, elf.isLittleEndian(), nextCU, partials, cuResults, cuDwarfVersions);
+
+            typeCacheHits += worker.getTypeCacheHits();
+            typeCacheMisses += worker.getTypeCacheMisses();
+        }));
+    }
+
+    for (auto &&worker : workers)
+    {
+        worker.join();
+    }
+
+    for (unsigned int i = 0; i < cuCount; i++)
+    {
+        if (partials.at(i) == nullptr)
         {
-            logger.logError("Error on siblings func");
+            logger.logError("CU %u was never read.", i + 1);
+            return_value = JUICER_ERROR;
+            break;
         }
 
-        dwarf_dealloc(dbg, cu_die, DW_DLA_DIE);
+        elf.merge(*partials.at(i));
+        partials.at(i).reset();
+
+        dwarfVersion = cuDwarfVersions.at(i);
+
+        /* readCUList stops reading CUs after the first one that fails, so stop merging there too. */
+        if (cuResults.at(i) != JUICER_OK)
+        {
+            logger.logError("Error on CU %u. Skipping the rest of the CUs.", i + 1);
+            break;
+        }
     }
+
     return return_value;
 }
 
+/**
+ *@brief The body of a readCUListParallel worker. Opens its own handle on elfFilePath and
+ *reads every CU it claims from nextCU into its slot in partials.
+ */
+void Juicer::readClaimedCUs(std::string &elfFilePath, bool littleEndian, std::atomic<unsigned int> &nextCU, std::vector<std::unique_ptr<ElfFile>> &partials,
+                            std::vector<int> &cuResults, std::vector<Dwarf_Half> &cuDwarfVersions)
+{
+    Dwarf_Unsigned cu_header_length = 0;
+    Dwarf_Half     version_stamp    = 0;
+    Dwarf_Unsigned abbrev_offset    = 0;
+    Dwarf_Half     address_size     = 0;
+    Dwarf_Unsigned next_cu_header   = 0;
+    Dwarf_Error    error            = 0;
+    unsigned int   cuIndex          = 0;
+    unsigned int   claimedCU        = 0;
+
+    if (openElf(elfFilePath, error) != JUICER_OK)
+    {
+        return;
+    }
+
+    claimedCU = nextCU++;
+
+    while (claimedCU < partials.size())
+    {
+        int res = dwarf_next_cu_header(dbg, &cu_header_length, &version_stamp, &abbrev_offset, &address_size, &next_cu_header, &error);
+
+        if (res != DW_DLV_OK)
+        {
+            logger.logError("Error in dwarf_next_cu_header. errno=%u %s", dwarf_errno(error), dwarf_errmsg(error));
+            break;
+        }
+
+        if (cuIndex == claimedCU)
+        {
+            JUICER_LOG_DEBUG(logger, "Reading CU %u.", cuIndex + 1);
+
+            partials.at(cuIndex) = std::make_unique<ElfFile>(elfFilePath);
+            partials.at(cuIndex)->isLittleEndian(littleEndian);
+
+            Logger::setContextCU(cuIndex + 1);
+
+            cuResults.at(cuIndex)       = readCU(*partials.at(cuIndex), dbg, error);
+            cuDwarfVersions.at(cuIndex) = dwarfVersion;
+
+            claimedCU                   = nextCU++;
+        }
+
+        cuIndex++;
+    }
+
+    Logger::clearContext();
+
+    closeElf();
+}
+
 char *Juicer::dwarfStringToChar(char *dwarfString)
 {
     uint32_t length = strlen(dwarfString);
@@ -568,17 +805,27 @@ int Juicer::process_DW_TAG_array_type(ElfFile &elf, Symbol &symbol, Dwarf_Debug
     return res;
 }
 
+/**
+ *@brief Follows the DW_AT_type chain of inDie until it reaches a DIE with a name.
+ *
+ *Resolved names are memoized in typeNameCache by the offset of the type DIE, so a type
+ *that many members point to is only walked once per parse.
+ *
+ *@return The name, or nullptr if it could not be resolved. The member res is left
+ *at DW_DLV_OK when a name is returned.
+ */
 char *Juicer::getFirstAncestorName(Dwarf_Die inDie)
 {
     Dwarf_Attribute attr_struct;
     Dwarf_Off       typeOffset = 0;
     Dwarf_Die       typeDie;
-    char           *outName = nullptr;
-    Dwarf_Bool      hasName = false;
-    Dwarf_Error     error   = 0;
+    char           *outName  = nullptr;
+    Dwarf_Bool      hasName  = false;
+    Dwarf_Error     error    = 0;
+    bool            cacheHit = false;
 
     /* Get the type attribute. */
-    res                     = dwarf_attr(inDie, DW_AT_type, &attr_struct, &error);
+    res                      = dwarf_attr(inDie, DW_AT_type, &attr_struct, &error);
 
     /* Get the offset to the type Die. */
     if (res == DW_DLV_OK)
@@ -590,8 +837,25 @@ char *Juicer::getFirstAncestorName(Dwarf_Die inDie)
         }
     }
 
-    /* Get the type Die. */
+    /* Has this chain already been walked? */
     if (res == DW_DLV_OK)
+    {
+        auto cachedName = typeNameCache.find(typeOffset);
+
+        if (cachedName != typeNameCache.end())
+        {
+            outName  = const_cast<char *>(cachedName->second.c_str());
+            cacheHit = true;
+            typeCacheHits++;
+        }
+        else
+        {
+            typeCacheMisses++;
+        }
+    }
+
+    /* Get the type Die. */
+    if (res == DW_DLV_OK && !cacheHit)
     {
         res = dwarf_offdie(dbg, typeOffset, &typeDie, &error);
         if (res != DW_DLV_OK)
@@ -601,7 +865,7 @@ char *Juicer::getFirstAncestorName(Dwarf_Die inDie)
     }
 
     /* Does this die have a name? */
-    if (res == DW_DLV_OK)
+    if (res == DW_DLV_OK && !cacheHit)
     {
         res = dwarf_hasattr(typeDie, DW_AT_name, &hasName, &error);
         if (res != DW_DLV_OK)
@@ -610,7 +874,7 @@ char *Juicer::getFirstAncestorName(Dwarf_Die inDie)
         }
     }
 
-    if (res == DW_DLV_OK)
+    if (res == DW_DLV_OK && !cacheHit)
     {
         if (hasName == false)
         {
@@ -634,6 +898,11 @@ char *Juicer::getFirstAncestorName(Dwarf_Die inDie)
                 }
             }
         }
+
+        if (res == DW_DLV_OK && outName != nullptr)
+        {
+            outName = const_cast<char *>(typeNameCache.emplace(typeOffset, outName).first->second.c_str());
+        }
     }
 
     return outName;
@@ -644,7 +913,6 @@ Symbol *Juicer::process_DW_TAG_pointer_type(ElfFile &elf, Dwarf_Debug dbg, Dwarf
     Symbol         *outSymbol   = 0;
     Dwarf_Attribute attr_struct = nullptr;
     Dwarf_Off       typeOffset  = 0;
-    Dwarf_Die       typeDie     = nullptr;
     Dwarf_Error     error       = 0;
     char           *typeDieName;
 
@@ -653,13 +921,13 @@ Symbol *Juicer::process_DW_TAG_pointer_type(ElfFile &elf, Dwarf_Debug dbg, Dwarf
     res = dwarf_attr(inDie, DW_AT_type, &attr_struct, &error);
     if (res != DW_DLV_OK)
     {
-        logger.logDebug("Ignoring error in dwarf_attr(DW_AT_type). %u  errno=%u %s", __LINE__, dwarf_errno(error), dwarf_errmsg(error));
+        JUICER_LOG_DEBUG(logger, "Ignoring error in dwarf_attr(DW_AT_type). %u  errno=%u %s", __LINE__, dwarf_errno(error), dwarf_errmsg(error));
 
         int voidRes = dwarf_attr(inDie, DW_AT_byte_size, &attr_struct, &error);
 
         if (voidRes != DW_DLV_OK)
         {
-            logger.logDebug("Ignoring error in dwarf_attr(DW_AT_byte_size). %u  errno=%u %s", __LINE__, dwarf_errno(error), dwarf_errmsg(error));
+            JUICER_LOG_DEBUG(logger, "Ignoring error in dwarf_attr(DW_AT_byte_size). %u  errno=%u %s", __LINE__, dwarf_errno(error), dwarf_errmsg(error));
         }
         else
         {
@@ -708,7 +976,7 @@ Symbol *Juicer::process_DW_TAG_pointer_type(ElfFile &elf, Dwarf_Debug dbg, Dwarf
                     /* This branch represents a "void*" since there is no valid type.
                      * Read section 5.2 of DWARF4 for details on this.*/
                     Artifact    newArtifact{elf, getdbgSourceFile(elf, pathIndex)};
-                    std::string checkSum = generateMD5SumForFile(newArtifact.getFilePath());
+                    std::string checkSum = generateChecksumForFile(newArtifact.getFilePath());
                     newArtifact.setMD5(checkSum);
                     outSymbol = elf.addSymbol(voidType, byteSize, newArtifact);
                 }
@@ -735,16 +1003,6 @@ Symbol *Juicer::process_DW_TAG_pointer_type(ElfFile &elf, Dwarf_Debug dbg, Dwarf
         }
     }
 
-    /* Get the type Die. */
-    if (res == DW_DLV_OK)
-    {
-        res = dwarf_offdie(dbg, typeOffset, &typeDie, &error);
-        if (res != DW_DLV_OK)
-        {
-            logger.logError("Error in dwarf_offdie.  errno=%u %s", dwarf_errno(error), dwarf_errmsg(error));
-        }
-    }
-
     /* Get the name of the type Die. */
     typeDieName = getFirstAncestorName(inDie);
 
@@ -799,7 +1057,6 @@ Symbol *Juicer::process_DW_TAG_variable_type(ElfFile &elf, Dwarf_Debug dbg, Dwar
     Symbol         *outSymbol   = 0;
     Dwarf_Attribute attr_struct = nullptr;
     Dwarf_Off       typeOffset  = 0;
-    Dwarf_Die       typeDie     = nullptr;
     Dwarf_Error     error       = 0;
     char           *typeDieName;
 
@@ -808,7 +1065,7 @@ Symbol *Juicer::process_DW_TAG_variable_type(ElfFile &elf, Dwarf_Debug dbg, Dwar
     res = dwarf_attr(inDie, DW_AT_type, &attr_struct, &error);
     if (res != DW_DLV_OK)
     {
-        logger.logDebug("Ignoring error in dwarf_attr(DW_AT_type). %u  errno=%u %s", __LINE__, dwarf_errno(error), dwarf_errmsg(error));
+        JUICER_LOG_DEBUG(logger, "Ignoring error in dwarf_attr(DW_AT_type). %u  errno=%u %s", __LINE__, dwarf_errno(error), dwarf_errmsg(error));
     }
 
     /* Get the offset to the type Die. */
@@ -821,16 +1078,6 @@ Symbol *Juicer::process_DW_TAG_variable_type(ElfFile &elf, Dwarf_Debug dbg, Dwar
         }
     }
 
-    /* Get the type Die. */
-    if (res == DW_DLV_OK)
-    {
-        res = dwarf_offdie(dbg, typeOffset, &typeDie, &error);
-        if (res != DW_DLV_OK)
-        {
-            logger.logError("Error in dwarf_offdie.  errno=%u %s", dwarf_errno(error), dwarf_errmsg(error));
-        }
-    }
-
     /* Get the name of the type Die. */
     typeDieName = getFirstAncestorName(inDie);
 
@@ -880,7 +1127,7 @@ Symbol *Juicer::process_DW_TAG_variable_type(ElfFile &elf, Dwarf_Debug dbg, Dwar
 
                     if (res == DW_DLV_OK)
                     {
-                        logger.logInfo("Found variable with name \"%s\"", outName);
+                        JUICER_LOG_INFO(logger, "Found variable with name \"%s\"", outName);
 
                         DimensionList dimList{};
                         // TODO:Really don't like the pattern of passing an empty object to getBaseTypeSymbol...
@@ -890,20 +1137,7 @@ Symbol *Juicer::process_DW_TAG_variable_type(ElfFile &elf, Dwarf_Debug dbg, Dwar
                         {
                             Variable newVariable{outName, *s, elf};
 
-                            if (elf.getInitializedSymbolData().find(outName) != elf.getInitializedSymbolData().end())
-                            {
-                                /**
-                                 * @todo variableData might be useful if we want to store the data
-                                 * inside the ELF inside of the db.
-                                 * CFS tables is an example of this.
-                                 * Though it should be noted that the data can be
-                                 * extracted by querying the SQL db; query_symbols.py is an example of this.
-                                 *
-                                 */
-                                std::vector<uint8_t> variableData = elf.getInitializedSymbolData().at(outName);
-                            }
-
-                            elf.addVariable(newVariable);
+                            elf.addVariable(std::move(newVariable));
                         }
                     }
                 }
@@ -924,10 +1158,12 @@ Symbol *Juicer::getBaseTypeSymbol(ElfFile &elf, Dwarf_Die inDie, DimensionList &
     char           *dieName    = 0;
     Dwarf_Half      tag;
     std::string     cName;
-    Dwarf_Error     error = 0;
+    Dwarf_Error     error     = 0;
+    bool            cacheHit  = false;
+    bool            cacheable = false;
 
     /* Get the type attribute. */
-    res                   = dwarf_attr(inDie, DW_AT_type, &attr_struct, &error);
+    res                       = dwarf_attr(inDie, DW_AT_type, &attr_struct, &error);
 
     if (res != DW_DLV_OK)
     {
@@ -944,8 +1180,25 @@ Symbol *Juicer::getBaseTypeSymbol(ElfFile &elf, Dwarf_Die inDie, DimensionList &
         }
     }
 
-    /* Get the type Die. */
+    /* Has this type DIE already been materialized into elf? */
     if (res == DW_DLV_OK)
+    {
+        auto cachedSymbol = typeSymbolCache.find(typeOffset);
+
+        if (cachedSymbol != typeSymbolCache.end() && &cachedSymbol->second->getElf() == &elf)
+        {
+            outSymbol = cachedSymbol->second;
+            cacheHit  = true;
+            typeCacheHits++;
+        }
+        else
+        {
+            typeCacheMisses++;
+        }
+    }
+
+    /* Get the type Die. */
+    if (res == DW_DLV_OK && !cacheHit)
     {
         res = dwarf_offdie(dbg, typeOffset, &typeDie, &error);
         if (res != DW_DLV_OK)
@@ -956,7 +1209,7 @@ Symbol *Juicer::getBaseTypeSymbol(ElfFile &elf, Dwarf_Die inDie, DimensionList &
 
     /* Get the tag so we know how to process it. */
 
-    if (res == DW_DLV_OK)
+    if (res == DW_DLV_OK && !cacheHit)
     {
         res = dwarf_tag(typeDie, &tag, &error);
         if (res != DW_DLV_OK)
@@ -965,13 +1218,14 @@ Symbol *Juicer::getBaseTypeSymbol(ElfFile &elf, Dwarf_Die inDie, DimensionList &
         }
     }
 
-    if (res == DW_DLV_OK)
+    if (res == DW_DLV_OK && !cacheHit)
     {
         switch (tag)
         {
             case DW_TAG_pointer_type:
             {
                 outSymbol = process_DW_TAG_pointer_type(elf, dbg, typeDie);
+                cacheable = true;
                 break;
             }
 
@@ -997,7 +1251,8 @@ Symbol *Juicer::getBaseTypeSymbol(ElfFile &elf, Dwarf_Die inDie, DimensionList &
                 /* Read the name from the Die that has it. */
                 if (structHasName)
                 {
-                    res = dwarf_attr(typeDie, DW_AT_name, &attr_struct, &error);
+                    cacheable = true;
+                    res       = dwarf_attr(typeDie, DW_AT_name, &attr_struct, &error);
                     if (res != DW_DLV_OK)
                     {
                         logger.logError("Error in dwarf_attr(DW_AT_name).  %u  errno=%u %s", __LINE__, dwarf_errno(error), dwarf_errmsg(error));
@@ -1088,7 +1343,7 @@ Symbol *Juicer::getBaseTypeSymbol(ElfFile &elf, Dwarf_Die inDie, DimensionList &
                              *
                              */
                             Artifact    newArtifact{elf, getdbgSourceFile(elf, pathIndex)};
-                            std::string checkSum = generateMD5SumForFile(newArtifact.getFilePath());
+                            std::string checkSum = generateChecksumForFile(newArtifact.getFilePath());
                             newArtifact.setMD5(checkSum);
                             outSymbol = elf.addSymbol(cName, byteSize, newArtifact);
                         }
@@ -1122,12 +1377,14 @@ Symbol *Juicer::getBaseTypeSymbol(ElfFile &elf, Dwarf_Die inDie, DimensionList &
             case DW_TAG_base_type:
             {
                 outSymbol = process_DW_TAG_base_type(elf, dbg, typeDie);
+                cacheable = true;
                 break;
             }
 
             case DW_TAG_typedef:
             {
                 outSymbol = process_DW_TAG_typedef(elf, dbg, typeDie);
+                cacheable = true;
 
                 break;
             }
@@ -1154,7 +1411,8 @@ Symbol *Juicer::getBaseTypeSymbol(ElfFile &elf, Dwarf_Die inDie, DimensionList &
                 /* Read the name from the Die that has it. */
                 if (structHasName)
                 {
-                    res = dwarf_attr(typeDie, DW_AT_name, &attr_struct, &error);
+                    cacheable = true;
+                    res       = dwarf_attr(typeDie, DW_AT_name, &attr_struct, &error);
                     if (res != DW_DLV_OK)
                     {
                         logger.logError("Error in dwarf_attr(DW_AT_name).  %u  errno=%u %s", __LINE__, dwarf_errno(error), dwarf_errmsg(error));
@@ -1261,7 +1519,7 @@ Symbol *Juicer::getBaseTypeSymbol(ElfFile &elf, Dwarf_Die inDie, DimensionList &
                              *
                              */
                             Artifact    newArtifact{elf, getdbgSourceFile(elf, pathIndex)};
-                            std::string checkSum = generateMD5SumForFile(newArtifact.getFilePath());
+                            std::string checkSum = generateChecksumForFile(newArtifact.getFilePath());
                             newArtifact.setMD5(checkSum);
                             outSymbol = elf.addSymbol(cName, byteSize, newArtifact);
                         }
@@ -1329,6 +1587,7 @@ Symbol *Juicer::getBaseTypeSymbol(ElfFile &elf, Dwarf_Die inDie, DimensionList &
             {
                 /* TODO */
                 outSymbol = process_DW_TAG_base_type(elf, dbg, typeDie);
+                cacheable = true;
                 break;
             }
 
@@ -1352,14 +1611,36 @@ Symbol *Juicer::getBaseTypeSymbol(ElfFile &elf, Dwarf_Die inDie, DimensionList &
         }
     }
 
+    /**
+     * Arrays, const types and anonymous structures/enumerations take their dimensions or name
+     * from inDie, so only types that are fully described by their own DIE are remembered.
+     */
+    if (cacheable && nullptr != outSymbol)
+    {
+        typeSymbolCache[typeOffset] = outSymbol;
+    }
+
     if (nullptr == outSymbol)
     {
-        logger.logDebug("outSymbol is null!");
+        JUICER_LOG_DEBUG(logger, "outSymbol is null!");
     }
 
     return outSymbol;
 }
 
+/**
+ *@brief Forgets every type resolved by getBaseTypeSymbol and getFirstAncestorName.
+ *DIE offsets are only meaningful for the Dwarf_Debug they came from, so this is
+ *called at the start of every parse.
+ */
+void Juicer::clearTypeCaches(void)
+{
+    typeSymbolCache.clear();
+    typeNameCache.clear();
+    typeCacheHits   = 0;
+    typeCacheMisses = 0;
+}
+
 void Juicer::DisplayDie(Dwarf_Die inDie, uint32_t level)
 {
     int              res = DW_DLV_OK;
@@ -3136,7 +3417,7 @@ Symbol *Juicer::process_DW_TAG_base_type(ElfFile &elf, Dwarf_Debug dbg, Dwarf_Di
     /* See if we already have this symbol. */
     if (dieName == nullptr)
     {
-        logger.logDebug("dieName is null.");
+        JUICER_LOG_DEBUG(logger, "dieName is null.");
     }
 
     else
@@ -3229,7 +3510,7 @@ Symbol *Juicer::process_DW_TAG_base_type(ElfFile &elf, Dwarf_Debug dbg, Dwarf_Di
                              *
                              */
                             Artifact    newArtifact{elf, getdbgSourceFile(elf, pathIndex)};
-                            std::string checkSum = generateMD5SumForFile(newArtifact.getFilePath());
+                            std::string checkSum = generateChecksumForFile(newArtifact.getFilePath());
                             newArtifact.setMD5(checkSum);
                             outSymbol = elf.addSymbol(sDieName, byteSize, newArtifact);
                         }
@@ -3519,7 +3800,7 @@ Symbol *Juicer::process_DW_TAG_typedef(ElfFile &elf, Dwarf_Debug dbg, Dwarf_Die
                  *
                  */
                 Artifact    newArtifact{elf, getdbgSourceFile(elf, pathIndex)};
-                std::string checkSum = generateMD5SumForFile(newArtifact.getFilePath());
+                std::string checkSum = generateChecksumForFile(newArtifact.getFilePath());
                 newArtifact.setMD5(checkSum);
                 outSymbol = elf.addSymbol(sDieName, byteSize, newArtifact, baseTypeSymbol);
             }
@@ -3882,7 +4163,7 @@ void Juicer::addPaddingToStruct(Symbol &symbol)
                 if (paddingSymbol == nullptr)
                 {
                     Artifact    newArtifact{symbol.getElf(), symbol.getArtifact().getFilePath()};
-                    std::string checkSum = generateMD5SumForFile(newArtifact.getFilePath());
+                    std::string checkSum = generateChecksumForFile(newArtifact.getFilePath());
                     newArtifact.setMD5(checkSum);
 
                     paddingSymbol = symbol.getElf().addSymbol(paddingType, paddingSize, newArtifact);
@@ -3892,8 +4173,8 @@ void Juicer::addPaddingToStruct(Symbol &symbol)
 
                 auto   fields_it = fields.begin();
 
-                fields.insert(fields_it + i,
-                              std::make_unique<Field>(symbol, spareName, (uint32_t)memberLocation, *paddingSymbol, symbol.getElf().isLittleEndian()));
+                fields.insert(fields_it + i, symbol.getElf().getArena().create<Field>(symbol, spareName, (uint32_t)memberLocation, *paddingSymbol,
+                                                                                      symbol.getElf().isLittleEndian()));
 
                 fieldsSize++;
                 i++;
@@ -3945,7 +4226,7 @@ void Juicer::addPaddingEndToStruct(Symbol &symbol)
             if (paddingSymbol == nullptr)
             {
                 Artifact    newArtifact{symbol.getElf(), symbol.getArtifact().getFilePath()};
-                std::string checkSum = generateMD5SumForFile(newArtifact.getFilePath());
+                std::string checkSum = generateChecksumForFile(newArtifact.getFilePath());
                 newArtifact.setMD5(checkSum);
                 paddingSymbol = symbol.getElf().addSymbol(paddingType, sizeDelta, newArtifact);
             }
@@ -4048,6 +4329,8 @@ int Juicer::getDieAndSiblings(ElfFile &elf, Dwarf_Debug dbg, Dwarf_Die in_die, i
         Dwarf_Half tag     = 0;
         Dwarf_Off  offset  = 0;
 
+        Stats::count(STATS_COUNTER_DIES);
+
         res                = dwarf_dieoffset(cur_die, &offset, &error);
 
         if (res != DW_DLV_OK)
@@ -4055,6 +4338,10 @@ int Juicer::getDieAndSiblings(ElfFile &elf, Dwarf_Debug dbg, Dwarf_Die in_die, i
             logger.logError("Error in dwarf_dieoffset , level %d.  errno=%u %s", in_level, dwarf_errno(error), dwarf_errmsg(error));
             return_value = JUICER_ERROR;
         }
+        else
+        {
+            Logger::setContextDIE(offset);
+        }
 
         DisplayDie(cur_die, in_level);
 
@@ -4106,6 +4393,8 @@ int Juicer::getDieAndSiblings(ElfFile &elf, Dwarf_Debug dbg, Dwarf_Die in_die, i
                     {
                         Dwarf_Unsigned     byteSize;
                         unsigned long long file_path_numbr = 0;
+
+                        Logger::setContextSymbol(dieName);
                         res                                = dwarf_bytesize(cur_die, &byteSize, &error);
                         std::string sDieName{dieName};
 
@@ -4150,7 +4439,7 @@ int Juicer::getDieAndSiblings(ElfFile &elf, Dwarf_Debug dbg, Dwarf_Die in_die, i
                                  *
                                  */
                                 Artifact    newArtifact{elf, getdbgSourceFile(elf, pathIndex)};
-                                std::string checkSum = generateMD5SumForFile(newArtifact.getFilePath());
+                                std::string checkSum = generateChecksumForFile(newArtifact.getFilePath());
                                 newArtifact.setMD5(checkSum);
                                 outSymbol = elf.addSymbol(sDieName, byteSize, newArtifact);
                             }
@@ -4298,13 +4587,13 @@ int Juicer::printDieData(Dwarf_Debug dbg, Dwarf_Die print_me, uint32_t level)
     res = dwarf_bytesize(print_me, &bytesize, &error);
     if (DW_DLV_OK == res)
     {
-        logger.logDebug(" byte size for %s is %u", name, bytesize);
+        JUICER_LOG_DEBUG(logger, " byte size for %s is %u", name, bytesize);
     }
 
     res = dwarf_bitsize(print_me, &bytesize, &error);
     if (DW_DLV_OK == res)
     {
-        logger.logDebug(" bit size for %s is %u", name, bytesize);
+        JUICER_LOG_DEBUG(logger, " bit size for %s is %u", name, bytesize);
     }
 
     if (DW_TAG_member == tag)
@@ -4323,13 +4612,70 @@ int Juicer::printDieData(Dwarf_Debug dbg, Dwarf_Die print_me, uint32_t level)
              */
         }
     }
-
-    if (!localname)
+
+    if (!localname)
+    {
+        dwarf_dealloc(dbg, name, DW_DLA_STRING);
+    }
+
+    return return_value;
+}
+
+/**
+ *@brief Returns the data of section index of elf, asking libelf for it the first time only.
+ */
+static Elf_Data *getSectionData(Elf *elf, std::vector<Elf_Data *> &sectionData, size_t index)
+{
+    if (index >= sectionData.size())
+    {
+        return nullptr;
+    }
+
+    if (sectionData[index] == nullptr)
+    {
+        sectionData[index] = elf_getdata(elf_getscn(elf, index), nullptr);
+    }
+
+    return sectionData[index];
+}
+
+/**
+ *@brief Copies the size bytes at offset in sectionData into symbolToData as the initial
+ *data of name. A name that is already there keeps its data.
+ */
+void Juicer::addSymbolData(std::map<std::string, std::vector<uint8_t>> &symbolToData, const char *name, Elf_Data *sectionData, uint64_t offset, uint64_t size)
+{
+    if (sectionData == nullptr)
+    {
+        logger.logWarning("Symbol %s ignored since its section has no data.", name);
+    }
+    else if (sectionData->d_type != ELF_T_BYTE)
     {
-        dwarf_dealloc(dbg, name, DW_DLA_STRING);
+        logger.logWarning("Symbol %s ignored since ELF_T_BYTE was NOT found. Found %d type instead.", name, sectionData->d_type);
     }
+    else
+    {
+        auto           inserted = symbolToData.emplace(name, std::vector<uint8_t>{});
+        const uint8_t *data     = (const uint8_t *)sectionData->d_buf;
 
-    return return_value;
+        if (!inserted.second)
+        {
+            JUICER_LOG_DEBUG(logger, "Symbol %s already has data.", name);
+        }
+        else if (data == nullptr)
+        {
+            /* Such as the symbols in .bss, which take no space in the file. */
+            JUICER_LOG_DEBUG(logger, "Symbol %s has no initial data.", name);
+        }
+        else if (offset <= sectionData->d_size && size <= sectionData->d_size - offset)
+        {
+            inserted.first->second.assign(data + offset, data + offset + size);
+        }
+        else
+        {
+            logger.logWarning("Symbol %s lies outside of its section.", name);
+        }
+    }
 }
 
 /**
@@ -4348,9 +4694,8 @@ std::map<std::string, std::vector<uint8_t>> Juicer::getObjDataFromElf(ElfFile *e
 
     std::map<std::string, std::vector<uint8_t>> symbolToData = std::map<std::string, std::vector<uint8_t>>();
 
-    elf_version(EV_CURRENT);
-
-    elf    = elf_begin(elfFile, ELF_C_READ, NULL);
+    /* Opened by openElf, which also ends it. */
+    elf    = elfHandle;
 
     buffer = elf_getident(elf, &size);
 
@@ -4366,11 +4711,18 @@ std::map<std::string, std::vector<uint8_t>> Juicer::getObjDataFromElf(ElfFile *e
 
                 logger.logInfo("Found %d elf sections", elfSectionCount);
 
+                /* Symbols point back into other sections, so look every header up once. */
+                std::vector<Elf64_Shdr *> sectionHeaders(elfSectionCount);
+                std::vector<Elf_Data *>   sectionData(elfSectionCount, nullptr);
+
                 for (size_t i = 0; i < elfSectionCount; i++)
                 {
-                    Elf_Scn    *section       = elf_getscn(elf, i);
+                    sectionHeaders[i] = elf64_getshdr(elf_getscn(elf, i));
+                }
 
-                    Elf64_Shdr *sectionHeader = elf64_getshdr(section);
+                for (size_t i = 0; i < elfSectionCount; i++)
+                {
+                    Elf64_Shdr *sectionHeader = sectionHeaders[i];
 
                     elfFileObj->addElf64SectionHeader(*sectionHeader);
 
@@ -4402,16 +4754,22 @@ std::map<std::string, std::vector<uint8_t>> Juicer::getObjDataFromElf(ElfFile *e
 
                             logger.logInfo("Found %d symbols in Elf", numberOfSymbols);
 
-                            Elf_Data *elfData = nullptr;
-                            elfData           = elf_getdata(section, elfData);
+                            Elf_Data *elfData = getSectionData(elf, sectionData, i);
                             if (elfData != nullptr)
                             {
                                 logger.logInfo("elfData Size:%d", elfData->d_size);
 
-                                Elf64_Sym *sectionTableData = (Elf64_Sym *)elfData->d_buf;
+                                Elf64_Sym  *sectionTableData      = (Elf64_Sym *)elfData->d_buf;
 
-                                size_t     strTableIndex    = sectionHeader->sh_link;
+                                size_t      strTableIndex         = sectionHeader->sh_link;
                                 logger.logInfo("String table index for symbols:%d", strTableIndex);
+
+                                /* Names are read straight out of the string table, which is the same for every symbol. */
+                                Elf_Data   *stringTableData       = getSectionData(elf, sectionData, strTableIndex);
+                                const char *stringTable           = stringTableData != nullptr ? (const char *)stringTableData->d_buf : nullptr;
+                                size_t      stringTableSize       = stringTable != nullptr ? stringTableData->d_size : 0;
+                                uint32_t    stringTableFileOffset = strTableIndex < elfSectionCount ? sectionHeaders[strTableIndex]->sh_offset : 0;
+
                                 for (int i = 0; i < numberOfSymbols; i++)
                                 {
                                     Elf64_Sym *symbol                          = sectionTableData;
@@ -4425,76 +4783,25 @@ std::map<std::string, std::vector<uint8_t>> Juicer::getObjDataFromElf(ElfFile *e
                                         {
                                             logger.logWarning("Ignoring symbol since it has SHN_COMMON as its st_shndx");
                                         }
-                                        else
+                                        else if (symbol->st_name > 0 && symbol->st_name < stringTableSize)
                                         {
-                                            Elf_Scn    *stringTableSection                  = elf_getscn(elf, strTableIndex);
-                                            Elf64_Shdr *stringTableSectionHeader            = elf64_getshdr(stringTableSection);
+                                            const char *name = stringTable + symbol->st_name;
+
+                                            JUICER_LOG_DEBUG(logger, "Found symbol %s with size: %d, st_value:%u, st_name:%u, st_info:%u, st_other:%u, st_shndx:%u\n", name,
+                                                             symbol->st_size, symbol->st_value, symbol->st_name, symbol->st_info, symbol->st_other, symbol->st_shndx);
 
-                                            Elf64_Xword stringTableSectionHeaderSectionSize = stringTableSectionHeader->sh_size;
+                                            symbolSectionStrTableFileOffset = stringTableFileOffset;
 
-                                            if (symbol->st_name > 0)
+                                            //                            TODO:Map it to DWARF here.
+                                            /* Symbols such as SHN_ABS ones have no section to read data from. */
+                                            if (symbol->st_shndx < elfSectionCount)
                                             {
-                                                char *currentStrTblPtr = elf_strptr(elf, strTableIndex, symbol->st_name);
+                                                Elf64_Shdr *symbolSectionHeader = sectionHeaders[symbol->st_shndx];
 
-                                                if (currentStrTblPtr != nullptr)
-                                                {
-                                                    int         stringTableCursor = 0;
-                                                    std::string name{};
-                                                    while (currentStrTblPtr[stringTableCursor] != '\0')
-                                                    {
-                                                        name.push_back(currentStrTblPtr[stringTableCursor]);
-                                                        stringTableCursor++;
-                                                    }
-
-                                                    logger.logInfo(
-                                                        "Found symbol %s with size: %d, st_value:%u, st_name:%u, st_info:%u, st_other:%u, st_shndx:%u\n",
-                                                        name.c_str(), symbol->st_size, symbol->st_value, symbol->st_name, symbol->st_info, symbol->st_other,
-                                                        symbol->st_shndx);
-
-                                                    symbolSectionStrTableFileOffset = stringTableSectionHeader->sh_offset;
-
-                                                    //                            TODO:Map it to DWARF here.
-                                                    Elf_Scn    *symbolSectionData   = elf_getscn(elf, symbol->st_shndx);
-
-                                                    Elf64_Shdr *symbolSectionHeader = elf64_getshdr(symbolSectionData);
-
-                                                    if (symbolSectionHeader != nullptr)
-                                                    {
-                                                        //                                                    std::cout << "symbol data section file offset-->"
-                                                        //                                                    << symbolSectionHeader->sh_offset << std::endl;
-                                                        symbolSectionFileOffset = symbolSectionHeader->sh_offset;
-                                                    }
-
-                                                    Elf_Data *symbolSectionDataContents = nullptr;
-
-                                                    symbolSectionDataContents           = elf_getdata(symbolSectionData, symbolSectionDataContents);
-
-                                                    if (symbolSectionDataContents->d_type == ELF_T_BYTE)
-                                                    {
-                                                        uint8_t             *symbolDataCursor = (uint8_t *)symbolSectionDataContents->d_buf;
-
-                                                        std::vector<uint8_t> symbolData       = std::vector<uint8_t>();
-
-                                                        if (symbolDataCursor != nullptr)
-                                                        {
-                                                            for (int i = symbol->st_value; i < symbol->st_size; i++)
-                                                            {
-                                                                symbolData.push_back(symbolDataCursor[i]);
-                                                            }
-                                                        }
-                                                        else
-                                                        {
-                                                            logger.logWarning("Did not find size for symbol \"%d\"", name);
-                                                        }
-
-                                                        symbolToData.insert({name, symbolData});
-                                                    }
-                                                    else
-                                                    {
-                                                        logger.logWarning("Symbol %s ignored since ELF_T_BYTE was NOT found. Found %d type instead.",
-                                                                          name.c_str(), symbolSectionDataContents->d_type);
-                                                    }
-                                                }
+                                                symbolSectionFileOffset = symbolSectionHeader->sh_offset;
+
+                                                addSymbolData(symbolToData, name, getSectionData(elf, sectionData, symbol->st_shndx), symbol->st_value - symbolSectionHeader->sh_addr,
+                                                              symbol->st_size);
                                             }
                                         }
                                     }
@@ -4676,7 +4983,6 @@ std::map<std::string, std::vector<uint8_t>> Juicer::getObjDataFromElf(ElfFile *e
                 {
                     rc = JUICER_ENDIAN_UNKNOWN;
                 }
-                elf_end(elf);
             }
             else
             {
@@ -4695,11 +5001,18 @@ std::map<std::string, std::vector<uint8_t>> Juicer::getObjDataFromElf(ElfFile *e
 
             logger.logInfo("Found %d elf sections", elfSectionCount);
 
+            /* Symbols point back into other sections, so look every header up once. */
+            std::vector<Elf32_Shdr *> sectionHeaders(elfSectionCount);
+            std::vector<Elf_Data *>   sectionData(elfSectionCount, nullptr);
+
             for (size_t i = 0; i < elfSectionCount; i++)
             {
-                Elf_Scn    *section       = elf_getscn(elf, i);
+                sectionHeaders[i] = elf32_getshdr(elf_getscn(elf, i));
+            }
 
-                Elf32_Shdr *sectionHeader = elf32_getshdr(section);
+            for (size_t i = 0; i < elfSectionCount; i++)
+            {
+                Elf32_Shdr *sectionHeader = sectionHeaders[i];
 
                 elfFileObj->addElf32SectionHeader(*sectionHeader);
 
@@ -4731,16 +5044,22 @@ std::map<std::string, std::vector<uint8_t>> Juicer::getObjDataFromElf(ElfFile *e
 
                         logger.logInfo("Found %d symbols in Elf", numberOfSymbols);
 
-                        Elf_Data *elfData = nullptr;
-                        elfData           = elf_getdata(section, elfData);
+                        Elf_Data *elfData = getSectionData(elf, sectionData, i);
                         if (elfData != nullptr)
                         {
                             logger.logInfo("elfData Size:%d", elfData->d_size);
 
-                            Elf32_Sym *sectionTableData = (Elf32_Sym *)elfData->d_buf;
+                            Elf32_Sym  *sectionTableData      = (Elf32_Sym *)elfData->d_buf;
 
-                            size_t     strTableIndex    = sectionHeader->sh_link;
+                            size_t      strTableIndex         = sectionHeader->sh_link;
                             logger.logInfo("String table index for symbols:%d", strTableIndex);
+
+                            /* Names are read straight out of the string table, which is the same for every symbol. */
+                            Elf_Data   *stringTableData       = getSectionData(elf, sectionData, strTableIndex);
+                            const char *stringTable           = stringTableData != nullptr ? (const char *)stringTableData->d_buf : nullptr;
+                            size_t      stringTableSize       = stringTable != nullptr ? stringTableData->d_size : 0;
+                            uint32_t    stringTableFileOffset = strTableIndex < elfSectionCount ? sectionHeaders[strTableIndex]->sh_offset : 0;
+
                             for (int i = 0; i < numberOfSymbols; i++)
                             {
                                 Elf32_Sym *symbol                          = sectionTableData;
@@ -4754,73 +5073,25 @@ std::map<std::string, std::vector<uint8_t>> Juicer::getObjDataFromElf(ElfFile *e
                                     {
                                         logger.logWarning("Ignoring symbol since it has SHN_COMMON as its st_shndx");
                                     }
-                                    else
+                                    else if (symbol->st_name > 0 && symbol->st_name < stringTableSize)
                                     {
-                                        Elf_Scn    *stringTableSection                  = elf_getscn(elf, strTableIndex);
-                                        Elf32_Shdr *stringTableSectionHeader            = elf32_getshdr(stringTableSection);
-
-                                        Elf32_Word  stringTableSectionHeaderSectionSize = stringTableSectionHeader->sh_size;
-
-                                        if (symbol->st_name > 0)
-                                        {
-                                            char *currentStrTblPtr = elf_strptr(elf, strTableIndex, symbol->st_name);
-
-                                            if (currentStrTblPtr != nullptr)
-                                            {
-                                                int         stringTableCursor = 0;
-                                                std::string name{};
-                                                while (currentStrTblPtr[stringTableCursor] != '\0')
-                                                {
-                                                    name.push_back(currentStrTblPtr[stringTableCursor]);
-                                                    stringTableCursor++;
-                                                }
-
-                                                logger.logInfo("Found symbol %s with size: %d, st_value:%u, st_name:%u, st_info:%u, st_other:%u, st_shndx:%u\n",
-                                                               name.c_str(), symbol->st_size, symbol->st_value, symbol->st_name, symbol->st_info,
-                                                               symbol->st_other, symbol->st_shndx);
+                                        const char *name = stringTable + symbol->st_name;
 
-                                                symbolSectionStrTableFileOffset = stringTableSectionHeader->sh_offset;
+                                        JUICER_LOG_DEBUG(logger, "Found symbol %s with size: %d, st_value:%u, st_name:%u, st_info:%u, st_other:%u, st_shndx:%u\n", name,
+                                                         symbol->st_size, symbol->st_value, symbol->st_name, symbol->st_info, symbol->st_other, symbol->st_shndx);
 
-                                                //                            TODO:Map it to DWARF here.
-                                                Elf_Scn    *symbolSectionData   = elf_getscn(elf, symbol->st_shndx);
-
-                                                Elf32_Shdr *symbolSectionHeader = elf32_getshdr(symbolSectionData);
-
-                                                if (symbolSectionHeader != nullptr)
-                                                {
-                                                    symbolSectionFileOffset = symbolSectionHeader->sh_offset;
-                                                }
+                                        symbolSectionStrTableFileOffset = stringTableFileOffset;
 
-                                                Elf_Data *symbolSectionDataContents = nullptr;
+                                        //                            TODO:Map it to DWARF here.
+                                        /* Symbols such as SHN_ABS ones have no section to read data from. */
+                                        if (symbol->st_shndx < elfSectionCount)
+                                        {
+                                            Elf32_Shdr *symbolSectionHeader = sectionHeaders[symbol->st_shndx];
 
-                                                symbolSectionDataContents           = elf_getdata(symbolSectionData, symbolSectionDataContents);
+                                            symbolSectionFileOffset = symbolSectionHeader->sh_offset;
 
-                                                if (symbolSectionDataContents->d_type == ELF_T_BYTE)
-                                                {
-                                                    uint8_t             *symbolDataCursor = (uint8_t *)symbolSectionDataContents->d_buf;
-
-                                                    std::vector<uint8_t> symbolData       = std::vector<uint8_t>();
-
-                                                    if (symbolDataCursor != nullptr)
-                                                    {
-                                                        for (int i = symbol->st_value; i < symbol->st_size; i++)
-                                                        {
-                                                            symbolData.push_back(symbolDataCursor[i]);
-                                                        }
-                                                    }
-                                                    else
-                                                    {
-                                                        logger.logWarning("Did not find size for symbol \"%d\"", name);
-                                                    }
-
-                                                    symbolToData.insert({name, symbolData});
-                                                }
-                                                else
-                                                {
-                                                    logger.logWarning("Symbol %s ignored since ELF_T_BYTE was NOT found. Found %d type instead.", name.c_str(),
-                                                                      symbolSectionDataContents->d_type);
-                                                }
-                                            }
+                                            addSymbolData(symbolToData, name, getSectionData(elf, sectionData, symbol->st_shndx), symbol->st_value - symbolSectionHeader->sh_addr,
+                                                          symbol->st_size);
                                         }
                                     }
                                 }
@@ -5001,7 +5272,6 @@ std::map<std::string, std::vector<uint8_t>> Juicer::getObjDataFromElf(ElfFile *e
             {
                 rc = JUICER_ENDIAN_UNKNOWN;
             }
-            elf_end(elf);
         }
         else
         {
@@ -5030,9 +5300,8 @@ JuicerEndianness_t Juicer::getEndianness()
     Elf64_Ehdr        *elf_hdr_64 = 0;
     Elf32_Ehdr        *elf_hdr_32 = 0;
 
-    elf_version(EV_CURRENT);
-
-    elf    = elf_begin(elfFile, ELF_C_READ, NULL);
+    /* Opened by openElf, which also ends it. */
+    elf    = elfHandle;
 
     buffer = elf_getident(elf, &size);
 
@@ -5055,7 +5324,6 @@ JuicerEndianness_t Juicer::getEndianness()
             {
                 rc = JUICER_ENDIAN_UNKNOWN;
             }
-            elf_end(elf);
         }
         else
         {
@@ -5082,7 +5350,6 @@ JuicerEndianness_t Juicer::getEndianness()
             {
                 rc = JUICER_ENDIAN_UNKNOWN;
             }
-            elf_end(elf);
         }
         else
         {
@@ -5116,112 +5383,428 @@ bool Juicer::isIDCSet(void)
 }
 
 /**
- *@brief Loads the ELF file into Juicer and finds out its endianness.
+ *@brief Loads the ELF file into Juicer, reads all of its DWARF and ELF data
+ *and writes it to the data container.
  *@param elfFilePath The path of the ELF file.
- *@return JUICER_OK if the file was opened successfully
- *and its endianness is identified. Returns JUICER_ERROR if either there was
- *an error opening the file or its endianness is unknown.
+ *@return JUICER_OK if the file was read and written successfully.
+ *Returns JUICER_ERROR if either there was an error opening the file,
+ *its endianness is unknown or it could not be written.
  */
 int Juicer::parse(std::string &elfFilePath)
 {
-    int         return_value = JUICER_OK;
-    Dwarf_Error error        = 0;
+    int return_value = JUICER_OK;
 
     /* Don't even continue if the IDC is not set. */
     if (isIDCSet())
     {
-        JuicerEndianness_t       endianness;
-        int                      dwarf_value = DW_DLV_OK;
-        /**@note elf's lifetime is tied to parser's scope. */
-        std::unique_ptr<ElfFile> elf         = std::make_unique<ElfFile>(elfFilePath);
-
-        elfFile                              = open(elfFilePath.c_str(), O_RDONLY);
-        if (elfFile < 0)
+        if (!isElfUnchanged(elfFilePath))
         {
-            logger.logError("Failed to load '%s'.  (%d) %s.", elfFilePath.c_str(), errno, strerror(errno));
-            return_value = JUICER_ERROR;
+            /**@note elf's lifetime is tied to parser's scope. */
+            std::unique_ptr<ElfFile> elf{};
+
+            return_value = readElf(elfFilePath, elf);
+
+            if (JUICER_OK == return_value && !isPipelined())
+            {
+                /* All done.  Write it out. */
+                logger.logInfo("Parsing of elf file '%s' is complete.  Writing to data container.", elfFilePath.c_str());
+                return_value = idc->write(*elf.get());
+            }
         }
-        else
+
+        finishChecksums();
+    }
+
+    return return_value;
+}
+
+/**
+ *@brief Parses every file in inputFilePaths into the same data container, in order.
+ *
+ *Every ELF is written in its own write() call, so one ELF that fails to parse or write
+ *does not keep the others out of the data container. The checksum cache is shared by all
+ *of them, so an artifact that many ELFs were built from is only hashed once.
+ *
+ *With more than one job and more than one file, up to jobs ELFs are read at the same
+ *time, each by its own Juicer on its own thread, and their CUs are read serially.
+ *Writing stays on the calling thread and in input order; a finished ELF waits for the
+ *ones before it, and readers never get more than jobs ELFs ahead of the writer.
+ *
+ *In incremental mode, the files the data container already has are dropped from the list first.
+ *
+ *@return JUICER_OK if every file was read and written successfully. Otherwise, JUICER_ERROR.
+ */
+int Juicer::parse(std::vector<std::string> &inputFilePaths)
+{
+    int                      return_value = JUICER_OK;
+    std::vector<std::string> elfFilePaths{};
+
+    if (!isIDCSet())
+    {
+        return return_value;
+    }
+
+    for (auto &&elfFilePath : inputFilePaths)
+    {
+        if (!isElfUnchanged(elfFilePath))
         {
-            logger.logDebug("Opened file '%s'.  fd=%u", elfFilePath.c_str(), elfFile);
+            elfFilePaths.push_back(elfFilePath);
         }
+    }
 
-        if (JUICER_OK == return_value)
+    if (jobs <= 1 || elfFilePaths.size() <= 1)
+    {
+        for (auto &&elfFilePath : elfFilePaths)
         {
-            /* Initialize the Dwarf library.  This will open the file. */
-            /* Initialize the Dwarf library.  This will open the file. */
-            dwarf_value = dwarf_init_b(elfFile, DW_DLC_READ, groupNumber, errhand, errarg, &dbg, &error);
-            if (dwarf_value != DW_DLV_OK)
+            std::unique_ptr<ElfFile> elf{};
+            int                      rc = readElf(elfFilePath, elf);
+
+            if (JUICER_OK == rc && !isPipelined())
+            {
+                logger.logInfo("Parsing of elf file '%s' is complete.  Writing to data container.", elfFilePath.c_str());
+                rc = idc->write(*elf.get());
+            }
+
+            if (JUICER_OK != rc)
             {
-                logger.logError("Failed to read the dwarf");
+                logger.logError("Failed to juice '%s'.", elfFilePath.c_str());
                 return_value = JUICER_ERROR;
             }
         }
+    }
+    else
+    {
+        size_t                                fileCount    = elfFilePaths.size();
+        unsigned int                          workerCount  = std::min<size_t>(jobs, fileCount);
+        size_t                                nextFile     = 0;
+        size_t                                writtenFiles = 0;
+        std::vector<std::unique_ptr<ElfFile>> elfs(fileCount);
+        std::vector<int>                      readResults(fileCount, JUICER_ERROR);
+        std::vector<bool>                     readDone(fileCount, false);
+        std::mutex                            filesMutex;
+        std::condition_variable               filesChanged;
+        std::vector<std::thread>              workers{};
+
+        logger.logInfo("Reading %u ELF files with %u workers.", fileCount, workerCount);
+
+        for (unsigned int i = 0; i < workerCount; i++)
+        {
+            workers.push_back(std::thread([&]() {
+                Juicer worker;
 
-        if (JUICER_OK == return_value)
+                worker.setExtras(extras);
+                worker.setMacros(macros);
+                worker.setGroupNumber(groupNumber);
+                worker.setChecksumAlgorithm(checksumAlgorithm);
+                worker.checksumCache = checksumCache;
+
+                while (true)
+                {
+                    std::unique_ptr<ElfFile> elf{};
+                    size_t                   index = 0;
+
+                    {
+                        std::unique_lock<std::mutex> lock(filesMutex);
+
+                        filesChanged.wait(lock, [&]() { return nextFile >= fileCount || nextFile < writtenFiles + workerCount; });
+
+                        if (nextFile >= fileCount)
+                        {
+                            break;
+                        }
+
+                        index = nextFile++;
+                    }
+
+                    int rc = worker.readElf(elfFilePaths.at(index), elf);
+
+                    {
+                        std::lock_guard<std::mutex> lock(filesMutex);
+
+                        elfs.at(index)        = std::move(elf);
+                        readResults.at(index) = rc;
+                        readDone.at(index)    = true;
+                    }
+
+                    filesChanged.notify_all();
+                }
+            }));
+        }
+
+        for (size_t i = 0; i < fileCount; i++)
         {
-            /* Get the endianness. */
-            endianness = getEndianness();
+            std::unique_ptr<ElfFile> elf{};
+            int                      rc = JUICER_ERROR;
 
-            if (extras)
             {
-                auto objDataMap = getObjDataFromElf(elf.get());
-                elf->setInitializedSymbolData(objDataMap);
-            }
+                std::unique_lock<std::mutex> lock(filesMutex);
 
-            /**
-             *@note For now, the checksum is always done.
-             */
-            std::string checkSum = generateMD5SumForFile(elfFilePath);
-            std::string date{""};
+                filesChanged.wait(lock, [&]() { return readDone.at(i); });
 
-            elf->setMD5(checkSum);
-            elf->setDate(date);
+                elf = std::move(elfs.at(i));
+                rc  = readResults.at(i);
+            }
 
-            if (JUICER_ENDIAN_BIG == endianness)
+            if (JUICER_OK == rc)
             {
-                logger.logDebug("Detected big endian.");
-                elf->isLittleEndian(false);
+                logger.logInfo("Parsing of elf file '%s' is complete.  Writing to data container.", elfFilePaths.at(i).c_str());
+                rc = idc->write(*elf.get());
             }
-            else if (JUICER_ENDIAN_LITTLE == endianness)
+
+            if (JUICER_OK != rc)
             {
-                logger.logDebug("Detected little endian.");
-                elf->isLittleEndian(true);
+                logger.logError("Failed to juice '%s'.", elfFilePaths.at(i).c_str());
+                return_value = JUICER_ERROR;
             }
-            else
+
+            /* Free this ELF before letting the readers move on. */
+            elf.reset();
+
             {
-                logger.logError("Endian is unknown. Aborting parse.");
-                return_value = JUICER_ERROR;
+                std::lock_guard<std::mutex> lock(filesMutex);
+                writtenFiles++;
             }
 
-            elf->isLittleEndian(JUICER_ENDIAN_BIG == endianness ? false : true);
+            filesChanged.notify_all();
         }
 
-        if (JUICER_OK == return_value)
+        for (auto &&worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    finishChecksums();
+
+    return return_value;
+}
+
+/**
+ *@brief Opens elfFilePath and initializes dbg over it.
+ *
+ *libelf maps the file once with ELF_C_READ_MMAP, and libdwarf reads its sections through
+ *that same handle. The endianness, the ELF sections and the checksum of the ELF all come
+ *from the mapping too, so the file is only paged in once however many of them need it.
+ *
+ *@return JUICER_OK if the file was opened and has DWARF. Nothing is left open otherwise.
+ */
+int Juicer::openElf(std::string &elfFilePath, Dwarf_Error &error)
+{
+    elfFile = open(elfFilePath.c_str(), O_RDONLY);
+    if (elfFile < 0)
+    {
+        logger.logError("Failed to load '%s'.  (%d) %s.", elfFilePath.c_str(), errno, strerror(errno));
+        return JUICER_ERROR;
+    }
+
+    JUICER_LOG_DEBUG(logger, "Opened file '%s'.  fd=%u", elfFilePath.c_str(), elfFile);
+
+    elf_version(EV_CURRENT);
+
+    elfHandle = elf_begin(elfFile, ELF_C_READ_MMAP, NULL);
+    if (elfHandle == NULL)
+    {
+        logger.logError("elf_begin failed.  errno=%d  %s", errno, strerror(errno));
+        close(elfFile);
+        return JUICER_ERROR;
+    }
+
+    if (dwarf_elf_init_b(elfHandle, DW_DLC_READ, groupNumber, errhand, errarg, &dbg, &error) != DW_DLV_OK)
+    {
+        logger.logError("Failed to read the dwarf");
+        elf_end(elfHandle);
+        elfHandle = NULL;
+        close(elfFile);
+        return JUICER_ERROR;
+    }
+
+    return JUICER_OK;
+}
+
+/**
+ *@brief Releases what openElf opened. dwarf_finish does not end an Elf handle it was given,
+ *so that is done here.
+ */
+void Juicer::closeElf(void)
+{
+    Dwarf_Error error = 0;
+
+    if (dwarf_finish(dbg, &error) != DW_DLV_OK)
+    {
+        logger.logWarning("dwarf_finish failed.  errno=%u  %s", errno, strerror(errno));
+    }
+
+    elf_end(elfHandle);
+    elfHandle = NULL;
+
+    close(elfFile);
+}
+
+/**
+ *@brief Loads the ELF file at elfFilePath and reads its DWARF and ELF data into elf.
+ *Nothing is written to the data container, unless isPipelined, in which case elf is
+ *written while it is read, and is in the data container once this returns JUICER_OK.
+ *
+ *@return JUICER_OK if the file was opened successfully and read. Returns JUICER_ERROR if
+ *either there was an error opening the file, its endianness is unknown or reading its CUs failed.
+ */
+int Juicer::readElf(std::string &elfFilePath, std::unique_ptr<ElfFile> &elf)
+{
+    int                return_value = JUICER_OK;
+    Dwarf_Error        error        = 0;
+    JuicerEndianness_t endianness;
+    bool               elfBegun     = false;
+
+    elf = std::make_unique<ElfFile>(elfFilePath);
+
+    {
+        Stats::Timer dwarfInitTimer{STATS_PHASE_DWARF_INIT};
+
+        return_value = openElf(elfFilePath, error);
+    }
+
+    if (JUICER_OK == return_value)
+    {
+        /* Get the endianness. */
+        endianness = getEndianness();
+
+        if (extras)
+        {
+            Stats::Timer elfSectionsTimer{STATS_PHASE_ELF_SECTIONS};
+
+            auto         objDataMap = getObjDataFromElf(elf.get());
+            elf->setInitializedSymbolData(std::move(objDataMap));
+        }
+
+        /**
+         *@note For now, the checksum is always done.
+         */
+        /* The ELF is already mapped by libelf, so hash that image instead of reading the file again. */
+        size_t      imageSize = 0;
+        const char *image     = elf_rawfile(elfHandle, &imageSize);
+        std::string checkSum  = generateChecksumForFile(elfFilePath, (const uint8_t *)image, imageSize);
+        std::string date{""};
+
+        elf->setMD5(checkSum);
+        elf->setChecksumAlgorithm(FileChecksum::getAlgorithmName(checksumAlgorithm));
+        elf->setDate(date);
+
+        if (JUICER_ENDIAN_BIG == endianness)
+        {
+            JUICER_LOG_DEBUG(logger, "Detected big endian.");
+            elf->isLittleEndian(false);
+        }
+        else if (JUICER_ENDIAN_LITTLE == endianness)
+        {
+            JUICER_LOG_DEBUG(logger, "Detected little endian.");
+            elf->isLittleEndian(true);
+        }
+        else
         {
-            return_value = readCUList(*elf.get(), dbg, error);
+            logger.logError("Endian is unknown. Aborting parse.");
+            return_value = JUICER_ERROR;
+        }
+
+        elf->isLittleEndian(JUICER_ENDIAN_BIG == endianness ? false : true);
+    }
+
+    if (JUICER_OK == return_value && isPipelined())
+    {
+        return_value = idc->beginElf(*elf.get());
+        elfBegun     = JUICER_OK == return_value;
+    }
+
+    if (JUICER_OK == return_value)
+    {
+        clearTypeCaches();
+        /* Macro unit offsets are only meaningful for the ELF they came from, too. */
+        importedMacroUnits.clear();
+        macroUnitCache->clear();
 
-            dwarf_value  = dwarf_finish(dbg, &error);
+        {
+            Stats::Timer cuWalkTimer{STATS_PHASE_CU_WALK};
 
-            if (dwarf_value != DW_DLV_OK)
+            if (jobs > 1)
             {
-                logger.logWarning("dwarf_finish failed.  errno=%u  %s", errno, strerror(errno));
+                return_value = readCUListParallel(*elf.get(), elfFilePath, dbg, error);
+            }
+            else
+            {
+                return_value = readCUList(*elf.get(), dbg, error);
             }
-
-            close(elfFile);
         }
 
+        Stats::count(STATS_COUNTER_ELFS);
+        Stats::count(STATS_COUNTER_SYMBOLS, elf->getSymbols().size());
+        Stats::count(STATS_COUNTER_FIELDS, elf->getFields().size());
+        Stats::count(STATS_COUNTER_ENUMERATIONS, elf->getEnumerations().size());
+        Stats::count(STATS_COUNTER_MACROS, elf->getDefineMacros().size());
+        Stats::count(STATS_COUNTER_VARIABLES, elf->getVariables().size());
+        Stats::count(STATS_COUNTER_TYPE_CACHE_HITS, typeCacheHits);
+        Stats::count(STATS_COUNTER_TYPE_CACHE_MISSES, typeCacheMisses);
+
+        logger.logInfo("Type cache: %llu hits, %llu misses.", (unsigned long long)typeCacheHits, (unsigned long long)typeCacheMisses);
+    }
+
+    if (elfHandle != NULL)
+    {
+        closeElf();
+    }
+
+    if (elfBegun)
+    {
+        int rc = idc->endElf(*elf.get(), JUICER_OK == return_value);
+
         if (JUICER_OK == return_value)
         {
-            /* All done.  Write it out. */
-            logger.logInfo("Parsing of elf file '%s' is complete.  Writing to data container.", elfFilePath.c_str());
-            return_value = idc->write(*elf.get());
+            return_value = rc;
         }
     }
 
     return return_value;
 }
 
+/**
+ *@brief In incremental mode, checks whether the data container already has elfFilePath with
+ *its current checksum. Such a file does not need to be juiced again.
+ *
+ *The checksum lands in checksumCache, so readElf does not hash the file again when it did change.
+ *
+ *@return true if elfFilePath can be skipped. Always false outside of incremental mode.
+ */
+bool Juicer::isElfUnchanged(std::string &elfFilePath)
+{
+    bool unchanged = false;
+    char resolvedPath[PATH_MAX];
+
+    if (incremental && realpath(elfFilePath.c_str(), resolvedPath) != nullptr)
+    {
+        std::string checksum = generateChecksumForFile(elfFilePath);
+
+        unchanged            = !checksum.empty() && idc->hasElf(resolvedPath, checksum, FileChecksum::getAlgorithmName(checksumAlgorithm));
+
+        if (unchanged)
+        {
+            logger.logInfo("'%s' has not changed since it was last juiced. Skipping it.", elfFilePath.c_str());
+        }
+    }
+
+    return unchanged;
+}
+
+/**
+ *@brief Logs how well the checksum cache did and saves it to checksumCacheFile, if there is one.
+ */
+void Juicer::finishChecksums(void)
+{
+    logger.logInfo("Checksum cache: %llu hits, %llu misses.", (unsigned long long)checksumCache->getHits(), (unsigned long long)checksumCache->getMisses());
+
+    if (!checksumCacheFile.empty())
+    {
+        checksumCache->save(checksumCacheFile);
+    }
+}
+
 uint32_t Juicer::calcArraySizeForDimension(Dwarf_Debug dbg, Dwarf_Die dieSubrangeType)
 {
     Dwarf_Unsigned  dwfUpperBound = 0;
@@ -5424,42 +6007,80 @@ std::vector<Dwarf_Die> Juicer::getChildrenVector(Dwarf_Debug dbg, Dwarf_Die pare
 
 void        Juicer::setIDC(IDataContainer *inIdc) { idc = inIdc; }
 
-std::string Juicer::generateMD5SumForFile(std::string filePath)
+std::string Juicer::generateChecksumForFile(std::string filePath) { return generateChecksumForFile(filePath, nullptr, 0); }
+
+/**
+ *@brief Returns the checksum of filePath as a hex string, made with checksumAlgorithm.
+ *
+ *Checksums are memoized in checksumCache by path, modification time and size, so
+ *a header referenced by many symbols is only read and hashed once.
+ *
+ *@param image The contents of filePath if they are already in memory, or nullptr to read the file.
+ */
+std::string Juicer::generateChecksumForFile(std::string filePath, const uint8_t *image, size_t imageSize)
 {
-    std::vector<uint8_t> tempHash{};
-    // read entire file into string
-    if (std::ifstream is{filePath, std::ios::binary | std::ios::ate})
+    struct stat fileStat;
+    int64_t     modifiedTime  = 0;
+    std::string checksum{};
+    std::string algorithmName = FileChecksum::getAlgorithmName(checksumAlgorithm);
+    bool        statOK        = stat(filePath.c_str(), &fileStat) == 0;
+
+    if (statOK)
     {
-        auto        size = is.tellg();
-        std::string str(size, '\0');  // construct string to stream size
-        is.seekg(0);
-        if (is.read(&str[0], size)) tempHash.reserve(MD5_DIGEST_LENGTH);
+        modifiedTime = (int64_t)fileStat.st_mtim.tv_sec * 1000000000 + fileStat.st_mtim.tv_nsec;
 
-        auto tmp = MD5((const unsigned char *)str.c_str(), size, NULL);
+        if (checksumCache->lookup(filePath, algorithmName, modifiedTime, fileStat.st_size, checksum))
+        {
+            Stats::count(STATS_COUNTER_CHECKSUM_CACHE_HITS);
+            return checksum;
+        }
 
-        tempHash.insert(tempHash.begin(), tmp, &tmp[MD5_DIGEST_LENGTH]);
+        Stats::count(STATS_COUNTER_CHECKSUM_CACHE_MISSES);
     }
 
-    std::ostringstream hex{};
-
-    if (tempHash.size() > 0)
     {
-        for (int i = 0; i < MD5_DIGEST_LENGTH; i++)
+        Stats::Timer checksumTimer{STATS_PHASE_CHECKSUM};
+
+        if (image != nullptr)
+        {
+            checksum = FileChecksum::compute(image, imageSize, checksumAlgorithm);
+        }
+        else
         {
-            // Ensure that we fill with zeroes. Otherwise our hash string will be missing zeroes.
-            hex << std::setfill('0') << std::setw(2) << std::right << std::hex << std::atoi(std::to_string(tempHash.at(i)).c_str());
+            checksum = FileChecksum::compute(filePath, checksumAlgorithm);
         }
     }
 
-    auto md5 = hex.str();
-    return md5;
+    Stats::count(STATS_COUNTER_FILES_HASHED);
+    Stats::count(STATS_COUNTER_BYTES_HASHED, statOK ? fileStat.st_size : 0);
+
+    if (statOK && !checksum.empty())
+    {
+        checksumCache->insert(filePath, algorithmName, modifiedTime, fileStat.st_size, checksum);
+    }
+
+    return checksum;
+}
+
+/**
+ *@brief Loads the checksums saved in cacheFilePath by an earlier run. parse() saves
+ *the cache back to cacheFilePath when it is done.
+ */
+void Juicer::setChecksumCacheFile(const std::string &cacheFilePath)
+{
+    checksumCacheFile = cacheFilePath;
+
+    if (checksumCache->load(checksumCacheFile) != CHECKSUMCACHE_OK)
+    {
+        logger.logWarning("Some entries of checksum cache '%s' could not be loaded. They will be hashed again.", checksumCacheFile.c_str());
+    }
 }
 
 /**
  * handles debug source files lookups for different DWARF versions.
  * It is assumed the pathIndex is the value of DW_AT_decl_file attribute
  */
-std::string &Juicer::getdbgSourceFile(ElfFile &elf, int pathIndex)
+InternedString Juicer::getdbgSourceFile(ElfFile &elf, int pathIndex)
 {
     switch (dwarfVersion)
     {
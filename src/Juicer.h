@@ -34,22 +34,31 @@
 #ifndef JUICER_H_
 #define JUICER_H_
 #include <fcntl.h>
+#include <libelf.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <sys/stat.h>  /* For open() */
 #include <sys/types.h> /* For open() */
 #include <unistd.h>
 
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+#include "ChecksumCache.h"
 #include "DimensionList.h"
 #include "ElfFile.h"
 #include "Enumeration.h"
 #include "Field.h"
+#include "FileChecksum.h"
 #include "Logger.h"
+#include "MacroUnitCache.h"
 #include "Symbol.h"
 #include "dwarf.h"
 #include "libdwarf.h"
@@ -93,6 +102,7 @@ class Juicer
    public:
     Juicer();
     int parse(std::string& elfFilePath);
+    int parse(std::vector<std::string>& inputFilePaths);
     virtual ~Juicer();
     JuicerEndianness_t getEndianness();
     void               setIDC(IDataContainer* idc);
@@ -101,16 +111,46 @@ class Juicer
 
     void               setExtras(bool extras) { this->extras = extras; }
 
+    bool               isMacros() const { return macros; }
+
+    void               setMacros(bool macros) { this->macros = macros; }
+
     void               setGroupNumber(unsigned int groupNumber) { this->groupNumber = groupNumber; };
+    bool               isIncremental() const { return incremental; }
+    void               setIncremental(bool incremental) { this->incremental = incremental; }
+    unsigned int       getJobs() const { return jobs; }
+    void               setJobs(unsigned int jobs) { this->jobs = jobs > 0 ? jobs : 1; }
+    bool               isPipeline() const { return pipeline; }
+    void               setPipeline(bool pipeline) { this->pipeline = pipeline; }
 
     unsigned int       getDwarfVersion();
+    uint64_t           getTypeCacheHits() const { return typeCacheHits; }
+    uint64_t           getTypeCacheMisses() const { return typeCacheMisses; }
+    void               setChecksumCacheFile(const std::string& cacheFilePath);
+    ChecksumCache&     getChecksumCache() { return *checksumCache; }
+    FileChecksum::Algorithm getChecksumAlgorithm() const { return checksumAlgorithm; }
+    void                    setChecksumAlgorithm(FileChecksum::Algorithm algorithm) { checksumAlgorithm = algorithm; }
 
    private:
     Dwarf_Debug              dbg = 0;
     int                      res = DW_DLV_ERROR;
-    Dwarf_Handler            errhand;
+    Dwarf_Handler            errhand = nullptr;
     Dwarf_Ptr                errarg = 0;
+    int                      openElf(std::string& elfFilePath, Dwarf_Error& error);
+    void                     closeElf(void);
+    int                      readElf(std::string& elfFilePath, std::unique_ptr<ElfFile>& elf);
+    bool                     isElfUnchanged(std::string& elfFilePath);
+    bool                     isPipelined(void) const { return pipeline && jobs <= 1 && idc != nullptr; }
+    void                     finishChecksums(void);
     int                      readCUList(ElfFile& elf, Dwarf_Debug dbg, Dwarf_Error& error);
+    int                      readCU(ElfFile& elf, Dwarf_Debug dbg, Dwarf_Error& error);
+    void                     readMacros(ElfFile& elf, Dwarf_Die cu_die, Dwarf_Error& error);
+    void                     readMacroOps(ElfFile& elf, Dwarf_Macro_Context macroContext, Dwarf_Unsigned opsCount, Dwarf_Die cu_die, Dwarf_Error& error,
+                                          std::vector<DefineMacro>& macros, std::unordered_set<Dwarf_Unsigned>* skipUnits);
+    const std::vector<DefineMacro>* getMacroUnit(ElfFile& elf, Dwarf_Unsigned offset, Dwarf_Die cu_die, Dwarf_Error& error);
+    int                      readCUListParallel(ElfFile& elf, std::string& elfFilePath, Dwarf_Debug dbg, Dwarf_Error& error);
+    void                     readClaimedCUs(std::string& elfFilePath, bool littleEndian, std::atomic<unsigned int>& nextCU,
+                                            std::vector<std::unique_ptr<ElfFile>>& partials, std::vector<int>& cuResults, std::vector<Dwarf_Half>& cuDwarfVersions);
     int                      getDieAndSiblings(ElfFile& elf, Dwarf_Debug dbg, Dwarf_Die in_die, int in_level);
     Symbol*                  process_DW_TAG_typedef(ElfFile& elf, Dwarf_Debug dbg, Dwarf_Die in_die);
     Symbol*                  process_DW_TAG_base_type(ElfFile& elf, Dwarf_Debug dbg, Dwarf_Die in_die);
@@ -127,10 +167,12 @@ class Juicer
     void                     addPaddingEndToStruct(Symbol& symbol);
     bool                     isDWARFVersionSupported(Dwarf_Die);
     int                      elfFile = 0;
+    Elf*                     elfHandle = nullptr;
     Logger                   logger;
     IDataContainer*          idc = 0;
     bool                     isIDCSet(void);
     Symbol*                  getBaseTypeSymbol(ElfFile& elf, Dwarf_Die inDie, DimensionList& multiplicity);
+    void                     clearTypeCaches(void);
     void                     DisplayDie(Dwarf_Die inDie, uint32_t level);
 
     std::vector<Dwarf_Die>   getChildrenVector(Dwarf_Debug dbg, Dwarf_Die die);
@@ -140,19 +182,75 @@ class Juicer
 
     DimensionList            getDimList(Dwarf_Debug dbg, Dwarf_Die die);
 
-    std::vector<std::string> dbgSourceFiles{};
+    std::vector<InternedString> dbgSourceFiles{};
 
-    std::string              generateMD5SumForFile(std::string filePath);
-    std::string&             getdbgSourceFile(ElfFile& elf, int pathIndex);
+    std::string              generateChecksumForFile(std::string filePath);
+    std::string              generateChecksumForFile(std::string filePath, const uint8_t* image, size_t imageSize);
+    InternedString           getdbgSourceFile(ElfFile& elf, int pathIndex);
     DefineMacro              getDefineMacro(Dwarf_Half macro_operator, Dwarf_Macro_Context mac_context, int i, Dwarf_Unsigned line_number, Dwarf_Unsigned index,
                                             Dwarf_Unsigned offset, const char* macro_string, Dwarf_Half& forms_count, Dwarf_Error& error, Dwarf_Die cu_die, ElfFile& elf);
     DefineMacro              getDefineMacroFromString(std::string macro_string);
     std::map<std::string, std::vector<uint8_t>> getObjDataFromElf(ElfFile* elfFileObj);
+    void                                        addSymbolData(std::map<std::string, std::vector<uint8_t>>& symbolToData, const char* name, Elf_Data* sectionData, uint64_t offset, uint64_t size);
 
     bool                                        extras;
+    /**
+     * When set, the .debug_macro units of every CU are read into the define macros of the elf.
+     */
+    bool                                        macros{true};
+    /**
+     * Offsets of the macro units whose macros this Juicer already added to the elf during this
+     * parse. Every CU that includes the same headers imports the same units, so the CUs after
+     * the first skip them without even looking at macroUnitCache.
+     */
+    std::unordered_set<Dwarf_Unsigned>          importedMacroUnits{};
+    /**
+     * The decoded macros of every imported macro unit of the ELF being read, shared with the
+     * workers of readCUListParallel so each unit is decoded once no matter which CU imports it.
+     */
+    std::shared_ptr<MacroUnitCache>             macroUnitCache{std::make_shared<MacroUnitCache>()};
 
     unsigned int                                groupNumber{0};
     Dwarf_Half                                  dwarfVersion = 0;
+    /**
+     * Number of threads used to read CUs. 1 reads them serially on the calling thread.
+     */
+    unsigned int                                jobs{1};
+    /**
+     * When set, ELF files the data container already has with the same checksum are skipped.
+     */
+    bool                                        incremental{false};
+    /**
+     * When set and CUs are read serially, the data container writes the symbols of each CU
+     * while the next ones are read. See IDataContainer::beginElf.
+     */
+    bool                                        pipeline{false};
+
+    /**
+     * Type DIEs that getBaseTypeSymbol already materialized during this parse, keyed by their
+     * global .debug_info offset. Only tags whose symbol depends on the type DIE alone are cached.
+     */
+    std::unordered_map<Dwarf_Off, Symbol*>      typeSymbolCache{};
+    /**
+     * Names getFirstAncestorName already resolved during this parse, keyed by the offset of
+     * the type DIE the chain starts at.
+     */
+    std::unordered_map<Dwarf_Off, std::string>  typeNameCache{};
+    std::atomic<uint64_t>                       typeCacheHits{0};
+    std::atomic<uint64_t>                       typeCacheMisses{0};
+
+    /**
+     * Checksums of the ELF and artifacts hashed so far. Shared with the --jobs workers.
+     */
+    std::shared_ptr<ChecksumCache>              checksumCache{std::make_shared<ChecksumCache>()};
+    /**
+     * When set, checksumCache is loaded from and saved to this file.
+     */
+    std::string                                 checksumCacheFile{};
+    /**
+     * Algorithm used for the checksums of the ELF and its artifacts.
+     */
+    FileChecksum::Algorithm                     checksumAlgorithm{FileChecksum::ALGORITHM_MD5};
 };
 
 #endif /* JUICER_H_ */
@@ -33,11 +33,43 @@
 
 #include "Logger.h"
 
+#include <stddef.h>
+#include <string.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <unordered_map>
+
 unsigned int    Logger::referenceCount = 0;
 LoggerInstance *Logger::instance       = 0;
+std::mutex      Logger::referenceMutex;
+
+/**
+ * Where the parser is on the calling thread, added to LOGGER_FORMAT_JSONL records.
+ * A CU number of 0 means no CU.
+ */
+struct LoggerContext
+{
+    unsigned int cuNumber{0};
+    bool         hasDIE{false};
+    uint64_t     dieOffset{0};
+    const char  *symbolName{nullptr};
+};
+
+static thread_local LoggerContext                                 context{};
+
+/**
+ * Event codes of the format strings the calling thread has logged in LOGGER_FORMAT_JSONL,
+ * by address, so the hash and the lock in defineEvent are paid once per call site.
+ */
+static thread_local std::unordered_map<const char *, uint32_t> knownEvents{};
 
 Logger::Logger()
 {
+    /* Symbols, fields and elves all carry a Logger, and with --jobs they are
+     * constructed from worker threads, so the reference count is guarded. */
+    std::lock_guard<std::mutex> lock(Logger::referenceMutex);
+
     if (Logger::referenceCount == 0)
     {
         /* No instances have been created yet.  Create one. */
@@ -69,22 +101,90 @@ bool Logger::setLogFile(const char *fileName)
     return rc;
 }
 
-void Logger::logError(const char *spec, ...)
+/**
+ *@brief Writes out everything queued for the log file and closes it.
+ *Later messages go to stdout again.
+ */
+void Logger::closeLogFile(void)
+{
+    if (Logger::instance != 0 && Logger::instance->isLogFileOpen())
+    {
+        Logger::instance->closeLogFile();
+    }
+}
+
+/**
+ *@brief Switches between plain text lines and JSON Lines records. See formatJSONRecord.
+ */
+void Logger::setLogFormat(LoggerFormat_t format)
 {
     if (Logger::instance != 0)
+    {
+        Logger::instance->setFormat(format);
+    }
+}
+
+/**
+ *@brief Sets the 1-based number of the CU the calling thread is reading and forgets
+ *the DIE and symbol of the previous CU.
+ */
+void Logger::setContextCU(unsigned int cuNumber)
+{
+    context.cuNumber   = cuNumber;
+    context.hasDIE     = false;
+    context.symbolName = nullptr;
+}
+
+/**
+ *@brief Sets the offset of the DIE the calling thread is reading and forgets the symbol
+ *of the previous DIE.
+ */
+void Logger::setContextDIE(uint64_t dieOffset)
+{
+    context.hasDIE     = true;
+    context.dieOffset  = dieOffset;
+    context.symbolName = nullptr;
+}
+
+/**
+ *@brief Sets the name of the symbol the current DIE defines. symbolName is not copied
+ *and has to stay valid until the next setContext call.
+ */
+void Logger::setContextSymbol(const char *symbolName) { context.symbolName = symbolName; }
+
+void Logger::clearContext(void) { context = LoggerContext{}; }
+
+/**
+ *@brief Returns true if a message of criticality would be logged at the current verbosity.
+ *Callers that build expensive arguments can check this first.
+ */
+bool Logger::isEnabled(LoggerCriticality_t criticality) { return Logger::instance != 0 && Logger::instance->isCriticalityEnabled(criticality); }
+
+/**
+ *@brief Formats spec and args and hands the message to the instance.
+ *The verbosity is checked before formatting, so a disabled message costs one comparison
+ *instead of two vsnprintf calls and a heap allocation.
+ */
+void Logger::logEvent(LoggerCriticality_t criticality, const char *spec, va_list args)
+{
+    if (isEnabled(criticality) && Logger::instance->getFormat() == LOGGER_FORMAT_JSONL)
+    {
+        std::string record = formatJSONRecord(criticality, spec, args);
+
+        Logger::instance->writeRecord(criticality, record);
+    }
+    else if (isEnabled(criticality))
     {
         std::string result;
 
-        va_list     args, args_copy;
+        va_list     args_copy;
 
-        va_start(args, spec);
         va_copy(args_copy, args);
 
         int len = vsnprintf(nullptr, 0, spec, args);
         if (len < 0)
         {
             va_end(args_copy);
-            va_end(args);
             throw std::runtime_error("vsnprintf error");
         }
 
@@ -99,122 +199,279 @@ void Logger::logError(const char *spec, ...)
         }
 
         va_end(args_copy);
-        va_end(args);
 
-        Logger::instance->LogEvent(LOGGER_EVENT_ERROR, result);
+        Logger::instance->LogEvent(criticality, result);
     }
 }
 
-void Logger::logWarning(const char *spec, ...)
+/**
+ *@brief Builds a LOGGER_FORMAT_JSONL record without formatting the message. The record has
+ *the level, an event code, the CU, DIE and symbol set with setContext* when there are
+ *any, and the arguments of spec in order:
+ *
+ *{"level":"warning","event":"9d3bc6a4","cu":3,"die":1234,"symbol":"Shape","args":["Shape"]}
+ *
+ *The event code is the 32-bit FNV-1a hash of spec, so it stays the same across runs as
+ *long as the message does. The first record of an event is preceded by its definition:
+ *
+ *{"event":"9d3bc6a4","format":"Union members are not yet supported in %s."}
+ */
+std::string Logger::formatJSONRecord(LoggerCriticality_t criticality, const char *spec, va_list args)
 {
-    if (Logger::instance != 0)
+    std::string record{};
+    uint32_t    eventCode  = 2166136261u;
+    char        eventName[9];
+    char        number[64];
+    auto        knownEvent = knownEvents.find(spec);
+    bool        isNewEvent = knownEvent == knownEvents.end();
+
+    if (isNewEvent)
     {
-        std::string result;
+        for (const char *c = spec; *c != '\0'; c++)
+        {
+            eventCode = (eventCode ^ (unsigned char)*c) * 16777619u;
+        }
 
-        va_list     args, args_copy;
+        knownEvents.emplace(spec, eventCode);
+    }
+    else
+    {
+        eventCode = knownEvent->second;
+    }
 
-        va_start(args, spec);
-        va_copy(args_copy, args);
+    for (int digit = 0; digit < 8; digit++)
+    {
+        eventName[digit] = "0123456789abcdef"[(eventCode >> ((7 - digit) * 4)) & 0xf];
+    }
 
-        int len = vsnprintf(nullptr, 0, spec, args);
-        if (len < 0)
-        {
-            va_end(args_copy);
-            va_end(args);
-            throw std::runtime_error("vsnprintf error");
-        }
+    eventName[8] = '\0';
 
-        if (len > 0)
-        {
-            result.resize(len);
-            // note: &result[0] is *guaranteed* only in C++11 and later
-            // to point to a buffer of contiguous memory with room for a
-            // null-terminator, but this "works" in earlier versions
-            // in *most* common implementations as well...
-            vsnprintf(&result[0], len + 1, spec, args_copy);  // or result.data() in C++17 and later...
-        }
+    record.reserve(128);
 
-        va_end(args_copy);
-        va_end(args);
+    if (isNewEvent && Logger::instance->defineEvent(eventCode))
+    {
+        record.append("{\"event\":\"").append(eventName).append("\",\"format\":");
+        LoggerInstance::appendJSONString(record, spec);
+        record.append("}\n");
+    }
 
-        Logger::instance->LogEvent(LOGGER_EVENT_WARNING, result);
+    record.append("{\"level\":\"").append(LoggerInstance::getCriticalityName(criticality)).append("\",\"event\":\"").append(eventName).append("\"");
+
+    if (context.cuNumber != 0)
+    {
+        record.append(",\"cu\":").append(std::to_string(context.cuNumber));
     }
-}
 
-void Logger::logInfo(const char *spec, ...)
-{
-    if (Logger::instance != 0)
+    if (context.hasDIE)
     {
-        std::string result;
+        record.append(",\"die\":").append(std::to_string(context.dieOffset));
+    }
 
-        va_list     args, args_copy;
+    if (context.symbolName != nullptr)
+    {
+        record.append(",\"symbol\":");
+        LoggerInstance::appendJSONString(record, context.symbolName);
+    }
 
-        va_start(args, spec);
-        va_copy(args_copy, args);
+    record.append(",\"args\":[");
 
-        int len = vsnprintf(nullptr, 0, spec, args);
-        if (len < 0)
+    auto        appendArgument = [&record](const std::string &value) {
+        if (record.back() != '[')
         {
-            va_end(args_copy);
-            va_end(args);
-            throw std::runtime_error("vsnprintf error");
+            record.push_back(',');
         }
 
-        if (len > 0)
+        record.append(value);
+    };
+
+    const char *c              = spec;
+
+    /* Walk the conversions of spec the way vsnprintf does and take each argument with
+     * its promoted type. */
+    while (*c != '\0')
+    {
+        if (*c++ != '%')
         {
-            result.resize(len);
-            // note: &result[0] is *guaranteed* only in C++11 and later
-            // to point to a buffer of contiguous memory with room for a
-            // null-terminator, but this "works" in earlier versions
-            // in *most* common implementations as well...
-            vsnprintf(&result[0], len + 1, spec, args_copy);  // or result.data() in C++17 and later...
+            continue;
         }
 
-        va_end(args_copy);
-        va_end(args);
+        if (*c == '%')
+        {
+            c++;
+            continue;
+        }
 
-        Logger::instance->LogEvent(LOGGER_EVENT_INFO, result);
-    }
-}
+        /* Flags, width and precision. A '*' takes its value from the arguments. */
+        while (*c != '\0' && strchr("-+ #0123456789.*", *c) != nullptr)
+        {
+            if (*c == '*')
+            {
+                appendArgument(std::to_string(va_arg(args, int)));
+            }
 
-void Logger::logDebug(const char *spec, ...)
-{
-    if (Logger::instance != 0)
-    {
-        std::string result;
+            c++;
+        }
 
-        va_list     args, args_copy;
+        char length[3] = {0};
 
-        va_start(args, spec);
-        va_copy(args_copy, args);
+        for (int i = 0; i < 2 && *c != '\0' && strchr("hljztL", *c) != nullptr; i++)
+        {
+            length[i] = *c++;
+        }
 
-        int len = vsnprintf(nullptr, 0, spec, args);
-        if (len < 0)
+        switch (*c)
         {
-            va_end(args_copy);
-            va_end(args);
-            throw std::runtime_error("vsnprintf error");
+            case 'd':
+            case 'i':
+            {
+                if (strcmp(length, "l") == 0)
+                {
+                    appendArgument(std::to_string(va_arg(args, long)));
+                }
+                else if (strcmp(length, "ll") == 0 || strcmp(length, "j") == 0)
+                {
+                    appendArgument(std::to_string(va_arg(args, long long)));
+                }
+                else if (strcmp(length, "z") == 0 || strcmp(length, "t") == 0)
+                {
+                    appendArgument(std::to_string(va_arg(args, ptrdiff_t)));
+                }
+                else
+                {
+                    appendArgument(std::to_string(va_arg(args, int)));
+                }
+
+                break;
+            }
+
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+            {
+                if (strcmp(length, "l") == 0)
+                {
+                    appendArgument(std::to_string(va_arg(args, unsigned long)));
+                }
+                else if (strcmp(length, "ll") == 0 || strcmp(length, "j") == 0)
+                {
+                    appendArgument(std::to_string(va_arg(args, unsigned long long)));
+                }
+                else if (strcmp(length, "z") == 0 || strcmp(length, "t") == 0)
+                {
+                    appendArgument(std::to_string(va_arg(args, size_t)));
+                }
+                else
+                {
+                    appendArgument(std::to_string(va_arg(args, unsigned int)));
+                }
+
+                break;
+            }
+
+            case 'c':
+            {
+                appendArgument(std::to_string(va_arg(args, int)));
+                break;
+            }
+
+            case 's':
+            {
+                const char *arg = va_arg(args, const char *);
+                std::string value{"null"};
+
+                if (arg != nullptr)
+                {
+                    value.clear();
+                    LoggerInstance::appendJSONString(value, arg);
+                }
+
+                appendArgument(value);
+                break;
+            }
+
+            case 'p':
+            {
+                snprintf(number, sizeof(number), "\"%p\"", va_arg(args, void *));
+                appendArgument(number);
+                break;
+            }
+
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+            {
+                long double arg = strcmp(length, "L") == 0 ? va_arg(args, long double) : va_arg(args, double);
+
+                /* JSON has no NaN or infinity. */
+                snprintf(number, sizeof(number), "%.17Lg", arg);
+                appendArgument(std::isfinite(arg) ? number : "null");
+                break;
+            }
+
+            case 'n':
+            {
+                va_arg(args, void *);
+                break;
+            }
         }
 
-        if (len > 0)
+        if (*c != '\0')
         {
-            result.resize(len);
-            // note: &result[0] is *guaranteed* only in C++11 and later
-            // to point to a buffer of contiguous memory with room for a
-            // null-terminator, but this "works" in earlier versions
-            // in *most* common implementations as well...
-            vsnprintf(&result[0], len + 1, spec, args_copy);  // or result.data() in C++17 and later...
+            c++;
         }
+    }
 
-        va_end(args_copy);
-        va_end(args);
+    record.append("]}\n");
 
-        Logger::instance->LogEvent(LOGGER_EVENT_DEBUG, result);
-    }
+    return record;
+}
+
+void Logger::logError(const char *spec, ...)
+{
+    va_list args;
+
+    va_start(args, spec);
+    logEvent(LOGGER_EVENT_ERROR, spec, args);
+    va_end(args);
+}
+
+void Logger::logWarning(const char *spec, ...)
+{
+    va_list args;
+
+    va_start(args, spec);
+    logEvent(LOGGER_EVENT_WARNING, spec, args);
+    va_end(args);
+}
+
+void Logger::logInfo(const char *spec, ...)
+{
+    va_list args;
+
+    va_start(args, spec);
+    logEvent(LOGGER_EVENT_INFO, spec, args);
+    va_end(args);
+}
+
+void Logger::logDebug(const char *spec, ...)
+{
+    va_list args;
+
+    va_start(args, spec);
+    logEvent(LOGGER_EVENT_DEBUG, spec, args);
+    va_end(args);
 }
 
 Logger::~Logger()
 {
+    std::lock_guard<std::mutex> lock(Logger::referenceMutex);
+
     /* Always decrement the reference count so we know when to delete
      * the instance.
      */
@@ -35,28 +35,69 @@
 #define LOGGER_H_
 
 #include <stdarg.h>
+#include <stdint.h>
 
 #include <fstream>
+#include <mutex>
 #include <string>
 
 #include "LoggerInstance.h"
 
+/**
+ *@brief The most verbose criticality that is compiled in, as a LoggerCriticality_t value.
+ *Calls made through JUICER_LOG_DEBUG or JUICER_LOG_INFO above this level are removed by
+ *the compiler, arguments included. Build with -DJUICER_LOG_LEVEL=1 (warnings) to drop the
+ *per-DIE and per-symbol messages from release builds entirely. When the level is compiled
+ *in, the verbosity is checked before the arguments are evaluated.
+ */
+#ifndef JUICER_LOG_LEVEL
+#define JUICER_LOG_LEVEL LOGGER_EVENT_DEBUG
+#endif
+
+#define JUICER_LOG_DEBUG(logger, ...)                                                         \
+    do                                                                                        \
+    {                                                                                         \
+        if (JUICER_LOG_LEVEL >= LOGGER_EVENT_DEBUG && (logger).isEnabled(LOGGER_EVENT_DEBUG)) \
+        {                                                                                     \
+            (logger).logDebug(__VA_ARGS__);                                                   \
+        }                                                                                     \
+    } while (0)
+
+#define JUICER_LOG_INFO(logger, ...)                                                          \
+    do                                                                                        \
+    {                                                                                         \
+        if (JUICER_LOG_LEVEL >= LOGGER_EVENT_INFO && (logger).isEnabled(LOGGER_EVENT_INFO))   \
+        {                                                                                     \
+            (logger).logInfo(__VA_ARGS__);                                                    \
+        }                                                                                     \
+    } while (0)
+
 class Logger
 {
    public:
     Logger();
     Logger(int verbosity);
     Logger(LoggerVerbosity_t verbosity);
-    void logError(const char *spec, ...);
-    void logWarning(const char *spec, ...);
-    void logInfo(const char *spec, ...);
-    void logDebug(const char *spec, ...);
-    bool setLogFile(const char *fileName);
+    void        logError(const char *spec, ...);
+    void        logWarning(const char *spec, ...);
+    void        logInfo(const char *spec, ...);
+    void        logDebug(const char *spec, ...);
+    bool        setLogFile(const char *fileName);
+    void        closeLogFile(void);
+    void        setLogFormat(LoggerFormat_t format);
+    bool        isEnabled(LoggerCriticality_t criticality);
+    static void setContextCU(unsigned int cuNumber);
+    static void setContextDIE(uint64_t dieOffset);
+    static void setContextSymbol(const char *symbolName);
+    static void clearContext(void);
     ~Logger();
 
    private:
+    void                   logEvent(LoggerCriticality_t criticality, const char *spec, va_list args);
+    std::string            formatJSONRecord(LoggerCriticality_t criticality, const char *spec, va_list args);
     static LoggerInstance *instance;
     static unsigned int    referenceCount;
+    static std::mutex      referenceMutex;
 };
 
 #endif /* LOGGER_H_ */
@@ -35,8 +35,10 @@
 
 #include <stdarg.h>
 #include <stddef.h>  // defines NULL
+#include <stdio.h>
 
 #include <array>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 
@@ -48,6 +50,13 @@
 #define LOGGER_ERROR_LABEL   "ERROR:   "
 #define LOGGER_UNKNOWN_LABEL "UNKNOWN: "
 
+/* Records the writer thread may fall behind by before LogEvent blocks. */
+#define LOGGER_QUEUE_DEPTH   (4096)
+
+/* Queued records that wake the writer early, and the longest a record waits otherwise. */
+#define LOGGER_QUEUE_BATCH   (LOGGER_QUEUE_DEPTH / 4)
+#define LOGGER_QUEUE_LATENCY std::chrono::milliseconds(20)
+
 LoggerInstance::LoggerInstance() {}
 
 LoggerInstance::~LoggerInstance()
@@ -79,6 +88,9 @@ bool LoggerInstance::openLogFile(std::string &inFileName)
         logFile.open(inFileName.data(), std::ios::out);
         if (logFile.is_open())
         {
+            stopWriter = false;
+            writer     = std::thread(&LoggerInstance::writeQueuedRecords, this);
+
             LogEvent(LOGGER_EVENT_DEBUG, "Opened log file.");
             rc = true;
         }
@@ -148,6 +160,8 @@ std::string LoggerInstance::getCriticalityLabel(LoggerCriticality_t criticality)
  * log level), then all messages are printed. Note that the file is truncated, so any old logs are gone.
  * However, if logLevel is set to LOGGER_VERBOSITY_SILENT, then no messages are
  * printed.
+ * Messages for the log file are handed to the writer thread, which writes them in batches.
+ * Errors wait until they, and everything logged before them, are on disk.
  * @param messageLevel the log level for this specific message.
  */
 void LoggerInstance::LogEvent(LoggerCriticality_t inCriticality, const std::string &inMessage)
@@ -155,26 +169,249 @@ void LoggerInstance::LogEvent(LoggerCriticality_t inCriticality, const std::stri
     if (isCriticalityEnabled(inCriticality))
     {
         /* Logging for this criticality is enabled. */
-        std::string label = getCriticalityLabel(inCriticality);
+        std::string record{};
 
-        if (isLogFileOpen())
+        if (format == LOGGER_FORMAT_JSONL)
         {
-            logFile << label << inMessage << std::endl;
-            logFile.flush();
+            /* Messages that were formatted before they got here have no event code. */
+            record.append("{\"level\":\"").append(getCriticalityName(inCriticality)).append("\",\"message\":");
+            appendJSONString(record, inMessage.c_str());
+            record.append("}\n");
         }
         else
         {
-            std::cout << label << inMessage << std::endl;
+            std::string label = getCriticalityLabel(inCriticality);
+
+            record.reserve(label.size() + inMessage.size() + 1);
+            record.append(label).append(inMessage).push_back('\n');
+        }
+
+        writeRecord(inCriticality, record);
+    }
+}
+
+/**
+ * @brief Writes a complete record, newline included, to the log file or stdout.
+ */
+void LoggerInstance::writeRecord(LoggerCriticality_t criticality, std::string &record)
+{
+    if (isLogFileOpen())
+    {
+        queueRecord(record, criticality == LOGGER_EVENT_ERROR);
+    }
+    else
+    {
+        /* Keep lines from different parser threads from interleaving. */
+        std::lock_guard<std::mutex> lock(eventMutex);
+
+        std::cout << record << std::flush;
+    }
+}
+
+/**
+ * @brief Marks eventCode as defined for LOGGER_FORMAT_JSONL.
+ * @return true the first time it is called for eventCode, when the caller has to write
+ * the definition of eventCode along with its record.
+ */
+bool LoggerInstance::defineEvent(uint32_t eventCode)
+{
+    std::lock_guard<std::mutex> lock(eventMutex);
+
+    return definedEvents.insert(eventCode).second;
+}
+
+void           LoggerInstance::setFormat(LoggerFormat_t inFormat) { format = inFormat; }
+
+LoggerFormat_t LoggerInstance::getFormat(void) const { return format; }
+
+/**
+ * @brief Returns the lower case name of criticality used in LOGGER_FORMAT_JSONL records.
+ */
+const char    *LoggerInstance::getCriticalityName(LoggerCriticality_t criticality)
+{
+    const char *name = "unknown";
+
+    switch (criticality)
+    {
+        case LOGGER_EVENT_DEBUG:
+        {
+            name = "debug";
+            break;
+        }
+
+        case LOGGER_EVENT_INFO:
+        {
+            name = "info";
+            break;
+        }
+
+        case LOGGER_EVENT_WARNING:
+        {
+            name = "warning";
+            break;
+        }
+
+        case LOGGER_EVENT_ERROR:
+        {
+            name = "error";
+            break;
+        }
+    }
+
+    return name;
+}
+
+/**
+ * @brief Appends value to record as a quoted JSON string.
+ */
+void LoggerInstance::appendJSONString(std::string &record, const char *value)
+{
+    record.push_back('"');
+
+    for (const char *c = value; *c != '\0'; c++)
+    {
+        /* Copy the run of characters that need no escaping in one go. */
+        const char *run = c;
+
+        while ((unsigned char)*c >= 0x20 && *c != '"' && *c != '\\')
+        {
+            c++;
+        }
+
+        record.append(run, c - run);
+
+        if (*c == '\0')
+        {
+            break;
+        }
+
+        switch (*c)
+        {
+            case '"':
+                record.append("\\\"");
+                break;
+            case '\\':
+                record.append("\\\\");
+                break;
+            case '\n':
+                record.append("\\n");
+                break;
+            case '\r':
+                record.append("\\r");
+                break;
+            case '\t':
+                record.append("\\t");
+                break;
+            default:
+            {
+                char escaped[8];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned char)*c);
+                record.append(escaped);
+            }
+        }
+    }
+
+    record.push_back('"');
+}
+
+/**
+ * @brief Appends record to the queue, waiting for room if the writer thread is behind.
+ * Records are written in the order they are queued, whichever thread queues them.
+ * @param waitForWrite if true, returns only after record has been written and flushed.
+ */
+void LoggerInstance::queueRecord(std::string &record, bool waitForWrite)
+{
+    std::unique_lock<std::mutex> lock(queueMutex);
+
+    queueNotFull.wait(lock, [this] { return queue.size() < LOGGER_QUEUE_DEPTH; });
+
+    queue.push_back(std::move(record));
+    queuedRecords++;
+
+    uint64_t recordNumber = queuedRecords;
+
+    if (waitForWrite)
+    {
+        flushRecords = recordNumber;
+        queueNotEmpty.notify_one();
+        queueWritten.wait(lock, [this, recordNumber] { return writtenRecords >= recordNumber; });
+    }
+    else if (queue.size() == LOGGER_QUEUE_BATCH)
+    {
+        queueNotEmpty.notify_one();
+    }
+}
+
+/**
+ * @brief Body of the writer thread. Wakes up when a batch has built up, an error is
+ * waiting to be flushed or LOGGER_QUEUE_LATENCY has passed, swaps the queue for an
+ * empty one and writes the records with a single write and flush. Repeats until
+ * closeLogFile stops it with an empty queue.
+ */
+void LoggerInstance::writeQueuedRecords(void)
+{
+    std::vector<std::string>     records{};
+    std::string                  batch{};
+    std::unique_lock<std::mutex> lock(queueMutex);
+
+    for (;;)
+    {
+        queueNotEmpty.wait_for(lock, LOGGER_QUEUE_LATENCY,
+                               [this] { return queue.size() >= LOGGER_QUEUE_BATCH || flushRecords > writtenRecords || stopWriter; });
+
+        if (queue.empty())
+        {
+            if (stopWriter)
+            {
+                break;
+            }
+
+            continue;
         }
+
+        /* Producers only wait for the swap, not for the write. */
+        records.swap(queue);
+        queueNotFull.notify_all();
+
+        lock.unlock();
+
+        batch.clear();
+
+        for (auto &&record : records)
+        {
+            batch.append(record);
+        }
+
+        logFile.write(batch.data(), batch.size());
+        logFile.flush();
+
+        lock.lock();
+
+        writtenRecords += records.size();
+        records.clear();
+        queueWritten.notify_all();
     }
 }
 
 /**
- * @brief closes logFile.
+ * @brief closes logFile, after everything queued for it has been written.
  * @return returns true if the logFile was closed successfully. Otherwise it returns false.
  */
 bool LoggerInstance::closeLogFile()
 {
+    /* Let the writer thread drain the queue before the file goes away. */
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopWriter = true;
+    }
+
+    queueNotEmpty.notify_one();
+
+    if (writer.joinable())
+    {
+        writer.join();
+    }
+
     logFile.close();
 
     if (!logFile.is_open())
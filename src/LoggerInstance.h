@@ -34,9 +34,16 @@
 #ifndef LOGGER_INSTANCE_H_
 #define LOGGER_INSTANCE_H_
 
+#include <stdint.h>
+
+#include <condition_variable>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 typedef enum
 {
@@ -55,30 +62,64 @@ typedef enum
     LOGGER_EVENT_DEBUG   = 3
 } LoggerCriticality_t;
 
+typedef enum
+{
+    LOGGER_FORMAT_TEXT  = 0,
+    LOGGER_FORMAT_JSONL = 1
+} LoggerFormat_t;
+
 class LoggerInstance
 {
    public:
     LoggerInstance();
     ~LoggerInstance();
-    void setVerbosity(LoggerVerbosity_t verbosity);
-    void LogEvent(LoggerCriticality_t criticality, const std::string &message);
+    void               setVerbosity(LoggerVerbosity_t verbosity);
+    void               LogEvent(LoggerCriticality_t criticality, const std::string &message);
+    void               setFormat(LoggerFormat_t format);
+    LoggerFormat_t     getFormat(void) const;
+    static void        appendJSONString(std::string &record, const char *value);
+    static const char *getCriticalityName(LoggerCriticality_t criticality);
 
    private:
-    LoggerInstance(LoggerInstance const &) {};                                   // copy constructor is private
-    LoggerInstance        &operator=(LoggerInstance const &) { return *this; };  // assignment operator is private
-    static LoggerInstance *m_pInstance;
-    std::ofstream          logFile;
-    std::string            logFileName;
-    LoggerVerbosity_t      Verbosity;
-    bool                   isCriticalityEnabled(LoggerCriticality_t criticality);
-    bool                   isCriticalityValid(LoggerCriticality_t criticality);
-    bool                   isVerbosityValid(LoggerVerbosity_t verbosity);
-    bool                   openLogFile(std::string &logFile);
-    bool                   openLogFile(const char *logFile);
-    void                   writeLogFileToStdOutput();
-    bool                   closeLogFile();
-    std::string            getCriticalityLabel(LoggerCriticality_t criticality);
-    bool                   isLogFileOpen();
+    LoggerInstance(LoggerInstance const &) {};                                          // copy constructor is private
+    LoggerInstance              &operator=(LoggerInstance const &) { return *this; };  // assignment operator is private
+    static LoggerInstance       *m_pInstance;
+    std::ofstream                logFile;
+    std::mutex                   eventMutex;
+    /**
+     * Records waiting for the writer thread, oldest first. Each record is a
+     * complete line, label and newline included.
+     */
+    std::vector<std::string>     queue;
+    uint64_t                     queuedRecords{0};
+    uint64_t                     writtenRecords{0};
+    uint64_t                     flushRecords{0};
+    bool                         stopWriter{false};
+    std::mutex                   queueMutex;
+    std::condition_variable      queueNotEmpty;
+    std::condition_variable      queueNotFull;
+    std::condition_variable      queueWritten;
+    std::thread                  writer;
+    std::string                  logFileName;
+    LoggerVerbosity_t            Verbosity;
+    LoggerFormat_t               format{LOGGER_FORMAT_TEXT};
+    /**
+     * Event codes whose format string has already been written in LOGGER_FORMAT_JSONL.
+     */
+    std::unordered_set<uint32_t> definedEvents;
+    bool                         isCriticalityEnabled(LoggerCriticality_t criticality);
+    bool                         isCriticalityValid(LoggerCriticality_t criticality);
+    bool                         isVerbosityValid(LoggerVerbosity_t verbosity);
+    bool                         openLogFile(std::string &logFile);
+    bool                         openLogFile(const char *logFile);
+    void                         writeLogFileToStdOutput();
+    bool                         closeLogFile();
+    void                         writeRecord(LoggerCriticality_t criticality, std::string &record);
+    void                         queueRecord(std::string &record, bool waitForWrite);
+    bool                         defineEvent(uint32_t eventCode);
+    void                         writeQueuedRecords(void);
+    std::string                  getCriticalityLabel(LoggerCriticality_t criticality);
+    bool                         isLogFileOpen();
 
     friend class Logger;
 };
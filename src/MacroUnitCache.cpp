@@ -0,0 +1,58 @@
+/*
+ * MacroUnitCache.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "MacroUnitCache.h"
+
+MacroUnitCache::MacroUnitCache() {}
+
+MacroUnitCache::~MacroUnitCache() {}
+
+/**
+ *@return The macros of the unit at offset, or nullptr if it was not decoded yet. The macros
+ *stay valid until clear is called.
+ */
+const std::vector<DefineMacro> *MacroUnitCache::lookup(uint64_t offset)
+{
+    std::lock_guard<std::mutex>     lock(unitsMutex);
+
+    const std::vector<DefineMacro> *macros = nullptr;
+    auto                            unit   = units.find(offset);
+
+    if (unit != units.end())
+    {
+        macros = &unit->second;
+        hits++;
+    }
+    else
+    {
+        misses++;
+    }
+
+    return macros;
+}
+
+/**
+ *@brief Records macros as the macros of the unit at offset.
+ *
+ *@return The cached macros of the unit. When two workers decode the same unit at once,
+ *both get the macros of the one that inserted first.
+ */
+const std::vector<DefineMacro> &MacroUnitCache::insert(uint64_t offset, std::vector<DefineMacro> macros)
+{
+    std::lock_guard<std::mutex> lock(unitsMutex);
+
+    return units.emplace(offset, std::move(macros)).first->second;
+}
+
+/**
+ *@brief Forgets every unit. Must not be called while another thread uses the cache.
+ */
+void MacroUnitCache::clear(void)
+{
+    std::lock_guard<std::mutex> lock(unitsMutex);
+
+    units.clear();
+}
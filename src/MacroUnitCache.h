@@ -0,0 +1,50 @@
+/*
+ * MacroUnitCache.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_MACROUNITCACHE_H_
+#define SRC_MACROUNITCACHE_H_
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "DefineMacro.h"
+
+/**
+ *@brief Remembers the macros of every .debug_macro unit juicer decoded, keyed by the
+ *section offset of the unit.
+ *
+ *gcc puts the macros of each header in a unit of their own, which every CU that includes
+ *the header imports with DW_MACRO_import. Headers like cfe.h are imported by almost every
+ *CU, so after the first import of a unit the others are a lookup.
+ *
+ *@note Offsets are only meaningful within one ELF, so the cache must be cleared before the
+ *next ELF is read. This class is thread-safe. Juicer shares one instance with all of the
+ *--jobs workers that read the CUs of the same ELF.
+ */
+class MacroUnitCache
+{
+   public:
+    MacroUnitCache();
+
+    const std::vector<DefineMacro> *lookup(uint64_t offset);
+    const std::vector<DefineMacro> &insert(uint64_t offset, std::vector<DefineMacro> macros);
+    void                            clear(void);
+
+    uint64_t                        getHits() const { return hits; }
+    uint64_t                        getMisses() const { return misses; }
+
+    virtual ~MacroUnitCache();
+
+   private:
+    std::unordered_map<uint64_t, std::vector<DefineMacro>> units{};
+    std::mutex                                             unitsMutex;
+    uint64_t                                               hits{0};
+    uint64_t                                               misses{0};
+};
+
+#endif /* SRC_MACROUNITCACHE_H_ */
@@ -0,0 +1,57 @@
+/*
+ * ObjectArena.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "ObjectArena.h"
+
+#include <stdint.h>
+
+ObjectArena::ObjectArena(size_t inBlockSize) : blockSize{inBlockSize} {}
+
+ObjectArena::~ObjectArena()
+{
+    /* Newest first, so an object is gone before anything it was built from. */
+    for (auto it = destructors.rbegin(); it != destructors.rend(); ++it)
+    {
+        it->destroy(it->object);
+    }
+}
+
+/**
+ *@brief Returns size bytes aligned to alignment from the current block, starting a new
+ *block when the current one is full. Requests larger than a block get a block of their own.
+ */
+void *ObjectArena::allocate(size_t size, size_t alignment)
+{
+    uintptr_t address = reinterpret_cast<uintptr_t>(cursor);
+    size_t    padding = (alignment - (address % alignment)) % alignment;
+
+    if (cursor == nullptr || padding + size > available)
+    {
+        size_t newBlockSize = size + alignment > blockSize ? size + alignment : blockSize;
+
+        blocks.push_back(std::unique_ptr<char[]>(new char[newBlockSize]));
+
+        cursor    = blocks.back().get();
+        available = newBlockSize;
+        address   = reinterpret_cast<uintptr_t>(cursor);
+        padding   = (alignment - (address % alignment)) % alignment;
+    }
+
+    char *object = cursor + padding;
+
+    cursor    += padding + size;
+    available -= padding + size;
+    bytesUsed += size;
+
+    return object;
+}
+
+/**
+ *@brief Returns the bytes handed out by allocate, without alignment padding.
+ */
+size_t ObjectArena::getBytesUsed(void) const { return bytesUsed; }
+
+size_t ObjectArena::getBlockCount(void) const { return blocks.size(); }
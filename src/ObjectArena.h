@@ -0,0 +1,74 @@
+/*
+ * ObjectArena.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_OBJECTARENA_H_
+#define SRC_OBJECTARENA_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ *@brief Monotonic allocator for the symbols, fields and enumerations of one ElfFile.
+ *
+ *Objects are bump-allocated from large blocks and never freed one by one. Their
+ *addresses stay valid for the lifetime of the arena. When the arena is destroyed it runs
+ *the destructors of the objects that need one, newest first, and then releases the
+ *blocks, which replaces one heap allocation and one free per object with one per block.
+ *
+ *@note This class is not thread-safe. Every ElfFile, including the per-CU partials of
+ *the --jobs workers, has its own arena.
+ */
+class ObjectArena
+{
+   public:
+    ObjectArena(size_t blockSize = 64 * 1024);
+    ObjectArena(const ObjectArena &)            = delete;
+    ObjectArena &operator=(const ObjectArena &) = delete;
+    ~ObjectArena();
+
+    void        *allocate(size_t size, size_t alignment);
+
+    /**
+     *@brief Constructs a T in the arena with args.
+     *@return The new object. It is destroyed together with the arena and must not be deleted.
+     */
+    template <typename T, typename... Args>
+    T *create(Args &&...args)
+    {
+        T *object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+
+        if (!std::is_trivially_destructible<T>::value)
+        {
+            destructors.push_back(Destructor{object, [](void *p) { static_cast<T *>(p)->~T(); }});
+        }
+
+        return object;
+    }
+
+    size_t getBytesUsed(void) const;
+    size_t getBlockCount(void) const;
+
+   private:
+    struct Destructor
+    {
+        void *object;
+        void (*destroy)(void *);
+    };
+
+    size_t                               blockSize;
+    std::vector<std::unique_ptr<char[]>> blocks{};
+    char                                *cursor{nullptr};
+    size_t                               available{0};
+    size_t                               bytesUsed{0};
+    std::vector<Destructor>              destructors{};
+};
+
+#endif /* SRC_OBJECTARENA_H_ */
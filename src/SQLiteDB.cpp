@@ -7,14 +7,28 @@
 
 #include "SQLiteDB.h"
 
+#include <errno.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <iomanip>
 #include <string>
+#include <unordered_set>
 
-SQLiteDB::SQLiteDB() : database(0) {}
+#include "Stats.h"
 
-SQLiteDB::~SQLiteDB() {}
+SQLiteDB::SQLiteDB() : database(0), onConflictClause{sqlite3_libversion_number() >= SQLITEDB_UPSERT_VERSION ? " ON CONFLICT DO NOTHING" : ""} {}
+
+SQLiteDB::~SQLiteDB()
+{
+    if (pipeline)
+    {
+        stopWriter();
+    }
+}
 
 /**
  *@brief This call back function assumes that the first column is that row's id,
@@ -72,43 +86,6 @@ int SQLiteDB::doesRowExistCallback(void* count, int argc, char** argv, char** az
     return 0;
 }
 
-/**
- *@brief Checks if the symbol called name exists on the symbols table.
- *
- *@param name The name of the symbol to check for.
- *
- *@return If the symbol with the name of name exists, this function returns true. Otherwise,
- *this function returns false.
- *@note Please note that this function assumes that ALL symbols in our table
- *are universally unique across all Elf files.
- */
-bool SQLiteDB::doesSymbolExist(std::string name)
-{
-    int32_t     row_count    = 0;
-
-    int         rc           = SQLITE_OK;
-
-    char*       errorMessage = nullptr;
-
-    std::string countRowsQuery{"SELECT COUNT(*) FROM symbols"};
-    countRowsQuery += " WHERE name=\"";
-    countRowsQuery += name + "\";";
-
-    rc              = sqlite3_exec(database, countRowsQuery.c_str(), SQLiteDB::doesRowExistCallback, &row_count, &errorMessage);
-
-    if (SQLITE_OK != rc)
-    {
-        logger.logWarning(
-            "Looks like there was a problem sending query \"%s\" "
-            "to the database.",
-            countRowsQuery.c_str());
-        logger.logError("%s", errorMessage);
-        row_count = 0;
-    }
-
-    return row_count == 0 ? false : true;
-}
-
 bool SQLiteDB::doEncodingsExist()
 {
     int32_t     row_count    = 0;
@@ -135,48 +112,13 @@ bool SQLiteDB::doEncodingsExist()
     return row_count == 0 ? false : true;
 }
 
-/**
- *@brief Checks if the symbol called name exists on the symbols table.
- *
- *@param name The name of the symbol to check for.
- *
- *@return If the symbol with the name of name exists, this function returns true. Otherwise,
- *this function returns false.
- *@note Please note that this function assumes that ALL symbols in our table
- *are universally unique across all Elf files.
- */
-bool SQLiteDB::doesArtifactExist(std::string filePath)
-{
-    int32_t     row_count    = 0;
-
-    int         rc           = SQLITE_OK;
-
-    char*       errorMessage = nullptr;
-
-    std::string countRowsQuery{"SELECT COUNT(*) FROM artifacts"};
-    countRowsQuery += " WHERE path=\"";
-    countRowsQuery += filePath + "\";";
-
-    rc              = sqlite3_exec(database, countRowsQuery.c_str(), SQLiteDB::doesRowExistCallback, &row_count, &errorMessage);
-
-    if (SQLITE_OK != rc)
-    {
-        logger.logWarning(
-            "Looks like there was a problem sending query \"%s\" "
-            "to the database.",
-            countRowsQuery.c_str());
-        logger.logError("%s", errorMessage);
-        row_count = 0;
-    }
-
-    return row_count == 0 ? false : true;
-}
-
 /**
  *@brief Opens the database at initString and creates the necessary schemas to
  *store ELF and DWARF data.
  *
- *@param initString the file path at which the database is located at.
+ *@param initString the file path at which the database is located at. If setBuildInMemory
+ *was called with true before, the database is built in memory and only written to the file
+ *by close.
  *
  *@return Returns SQLITE_OK if the data database was opened successfully
  *and schemas were created successfully as well.
@@ -189,7 +131,14 @@ int SQLiteDB::initialize(std::string& initString)
      * to initialize.  For now, this is literally just the file name so we
      * can just use the string directly.
      */
-    rc     = openDatabase(initString);
+    if (buildInMemory)
+    {
+        rc = openInMemoryDatabase(initString);
+    }
+    else
+    {
+        rc = openDatabase(initString);
+    }
 
     if (SQLITE_OK == rc)
     {
@@ -227,220 +176,170 @@ int SQLiteDB::close(void)
 {
     int rc = SQLITEDB_OK;
 
-    rc     = sqlite3_close(database);
-
-    if (SQLITE_OK == rc)
-    {
-        logger.logDebug("The database was closed successfully.");
-    }
-    else
+    if (!destinationPath.empty() && database != nullptr)
     {
-        logger.logError("There was an error while closing the database.");
-        rc = SQLITEDB_ERROR;
-    }
+        Stats::Timer timer{STATS_PHASE_DB_SAVE};
 
-    return rc;
-}
-
-/**
- *@brief Establish a new connection to the database at databaseName.
- *If the file does not yet exist, this will create it.
- *
- *@return Returns SQLITE_OK if it is able to open the database successfully.
- *If opening the database fails, then SQLITESTRUCTURE_ERROR is returned.
- */
-int SQLiteDB::openDatabase(std::string& fileName)
-{
-    int rc = sqlite3_open(fileName.c_str(), &database);
+        rc = saveInMemoryDatabase();
+    }
 
-    if (SQLITE_OK == rc)
+    if (SQLITE_OK == sqlite3_close(database))
     {
-        logger.logDebug("Created the database with OK status");
+        JUICER_LOG_DEBUG(logger, "The database was closed successfully.");
+        database = nullptr;
     }
     else
     {
+        logger.logError("There was an error while closing the database.");
         rc = SQLITEDB_ERROR;
-        logger.logError("Failed to create the database with SQLITEDB_ERROR status.", sqlite3_errmsg(database));
     }
 
     return rc;
 }
 
 /**
- *@brief Writes all the data such as Elf, Symbols and elfs entries
- *to the SQLite database.
+ *@brief Opens an in-memory database that close writes to fileName. If fileName already
+ *is a database, its contents are loaded first, so juicing into it appends as usual.
  *
- *@param inElf The elf that contains all of the DWARF and ELF data.
+ *Every row is written to memory, so the write phase does no disk I/O at all, and a run
+ *that crashes before close leaves the file at fileName as it was.
  *
- *@return SQLITE_OK if it was able to write the all of data to the database
- *successfully. Please note that attempting to write an entry that already exists is NOT an error
- *in juicer's context; if a user attempts to write a record that already exists, this function returns SQLITE_OK.
- *Otherwise, this method returns SQLITEDB_ERROR.
+ *@return Returns SQLITEDB_OK if the database was opened and loaded successfully.
  */
-int SQLiteDB::write(ElfFile& inElf)
+int SQLiteDB::openInMemoryDatabase(std::string& fileName)
 {
-    int rc = SQLITEDB_OK;
+    std::string memoryName{":memory:"};
+    struct stat fileStat;
+    int         rc = openDatabase(memoryName);
 
-    rc     = writeElfToDatabase(inElf);
-
-    /**
-     *@note I'm not 100% sure about nesting if statements
-     *because it gets a bit out of control in cases like these.
-     *I know this is a tool that will always be running,
-     *but is there a possibility of considering exceptions here?
-     *I know exceptions aren't great, but my thinking
-     *is that this write function is "atomic" in a way.
-     *What I mean by that is that ALL queries must be successful in order for
-     *the call to be valid. Maybe there is something I'm missing, but just
-     *thought I'd propose the possibility of exceptions in cases like this.
-     */
-    if (SQLITEDB_ERROR != rc)
+    if (SQLITEDB_OK == rc)
     {
-        logger.logDebug(
-            "Elf entries were written to the elfs schema with SQLITE_OK "
-            "status.");
+        destinationPath = fileName;
 
-        if (SQLITEDB_ERROR != rc)
+        if (stat(fileName.c_str(), &fileStat) == 0 && fileStat.st_size > 0)
         {
-            rc = writeElfToDatabase(inElf);
+            sqlite3* existingDatabase = nullptr;
 
-            if (SQLITEDB_ERROR != rc)
+            if (sqlite3_open_v2(fileName.c_str(), &existingDatabase, SQLITE_OPEN_READONLY, nullptr) == SQLITE_OK)
             {
-                rc = writeArtifactsToDatabase(inElf);
-
-                if (SQLITEDB_ERROR != rc)
-                {
-                    rc = writeMacrosToDatabase(inElf);
-                }
-                else
-                {
-                    logger.logDebug(
-                        "There was an error while writing macro entries to the"
-                        " database.");
-                    rc = SQLITEDB_ERROR;
-                }
+                rc = copyDatabase(existingDatabase, database);
             }
             else
             {
-                logger.logDebug(
-                    "There was an error while writing field entries to the"
-                    " database.");
+                logger.logError("Failed to open '%s' to load it into memory. %s", fileName.c_str(), sqlite3_errmsg(existingDatabase));
                 rc = SQLITEDB_ERROR;
             }
 
-            rc = writeEncodingsToDatabase(inElf);
+            sqlite3_close(existingDatabase);
+        }
+    }
 
-            if (SQLITEDB_ERROR != rc)
-            {
-                logger.logDebug(
-                    "Variable entries were written to the variables schema "
-                    "with SQLITE_OK status.");
-            }
-            else
-            {
-                logger.logDebug(
-                    "There was an error while writing variable entries to the"
-                    " database.");
-                rc = SQLITEDB_ERROR;
-            }
+    if (SQLITEDB_OK == rc)
+    {
+        logger.logInfo("Building the database in memory. It will be written to '%s' when juicer is done.", fileName.c_str());
+    }
 
-            rc = writeSymbolsToDatabase(inElf);
+    return rc;
+}
 
-            if (SQLITEDB_ERROR != rc)
-            {
-                logger.logDebug(
-                    "Symbol entries were written to the symbols schema "
-                    "with SQLITE_OK status.");
+/**
+ *@brief Writes the in-memory database to a temporary file next to destinationPath and
+ *renames it over destinationPath, so readers see either the old database or the whole new one.
+ *
+ *@return Returns SQLITEDB_OK if destinationPath was replaced.
+ */
+int SQLiteDB::saveInMemoryDatabase(void)
+{
+    int         rc           = SQLITEDB_OK;
+    std::string tempPath     = destinationPath + ".XXXXXX";
+    sqlite3*    fileDatabase = nullptr;
+    struct stat fileStat;
+    mode_t      mode = 0;
+    int         fd   = mkstemp(&tempPath[0]);
 
-                rc = writeFieldsToDatabase(inElf);
+    if (fd < 0)
+    {
+        logger.logError("Failed to create a temporary file next to '%s'.  (%d) %s.", destinationPath.c_str(), errno, strerror(errno));
+        return SQLITEDB_ERROR;
+    }
 
-                writeDimensionsListToDatabase(inElf);
+    /* mkstemp creates the file for the owner only. Give it the mode a new database would get, or keep the old one's. */
+    if (stat(destinationPath.c_str(), &fileStat) == 0)
+    {
+        mode = fileStat.st_mode & 0777;
+    }
+    else
+    {
+        mode = umask(0);
+        umask(mode);
+        mode = 0666 & ~mode;
+    }
 
-                if (SQLITEDB_ERROR != rc)
-                {
-                    logger.logDebug(
-                        "Field entries were written to the fields schema "
-                        "with SQLITE_OK status.");
+    fchmod(fd, mode);
+    ::close(fd);
 
-                    rc = writeEnumerationsToDatabase(inElf);
+    if (sqlite3_open(tempPath.c_str(), &fileDatabase) == SQLITE_OK)
+    {
+        /* Nothing is ever rolled back in the temporary file; it is deleted if the copy fails. */
+        sqlite3_exec(fileDatabase, "PRAGMA journal_mode=OFF;", NULL, NULL, NULL);
 
-                    if (SQLITEDB_ERROR != rc)
-                    {
-                        logger.logInfo(
-                            "Enumeration entries were written to the fields schema "
-                            "with SQLITE_OK status.");
-                        rc = SQLITE_OK;
+        rc = copyDatabase(database, fileDatabase);
+    }
+    else
+    {
+        logger.logError("Failed to open '%s'. %s", tempPath.c_str(), sqlite3_errmsg(fileDatabase));
+        rc = SQLITEDB_ERROR;
+    }
 
-                        rc = writeVariablesToDatabase(inElf);
-                        if (SQLITEDB_ERROR != rc)
-                        {
-                            logger.logDebug(
-                                "Variable entries were written to the variables schema "
-                                "with SQLITE_OK status.");
+    if (sqlite3_close(fileDatabase) != SQLITE_OK)
+    {
+        rc = SQLITEDB_ERROR;
+    }
 
-                            rc = writeElfSectionsToDatabase(inElf);
+    if (SQLITEDB_OK == rc && rename(tempPath.c_str(), destinationPath.c_str()) != 0)
+    {
+        logger.logError("Failed to rename '%s' to '%s'.  (%d) %s.", tempPath.c_str(), destinationPath.c_str(), errno, strerror(errno));
+        rc = SQLITEDB_ERROR;
+    }
 
-                            if (SQLITEDB_ERROR != rc)
-                            {
-                                logger.logDebug(
-                                    "Variable entries were written to the variables schema "
-                                    "with SQLITE_OK status.");
+    if (SQLITEDB_OK == rc)
+    {
+        logger.logInfo("Wrote the database to '%s'.", destinationPath.c_str());
+    }
+    else
+    {
+        logger.logError("Failed to write the database to '%s'. It was left as it was.", destinationPath.c_str());
+        unlink(tempPath.c_str());
+    }
 
-                                rc = writeElfSymboltableSymbolsToDatabase(inElf);
+    return rc;
+}
 
-                                if (SQLITEDB_ERROR != rc)
-                                {
-                                    logger.logDebug(
-                                        "Variable entries were written to the variables schema "
-                                        "with SQLITE_OK status.");
-                                }
-                                else
-                                {
-                                    logger.logDebug(
-                                        "There was an error while writing variable entries to the"
-                                        " database.");
-                                    rc = SQLITEDB_ERROR;
-                                }
-                            }
-                            else
-                            {
-                                logger.logDebug(
-                                    "There was an error while writing variable entries to the"
-                                    " database.");
-                                rc = SQLITEDB_ERROR;
-                            }
-                        }
-                        else
-                        {
-                            logger.logDebug(
-                                "There was an error while writing variable entries to the"
-                                " database.");
-                            rc = SQLITEDB_ERROR;
-                        }
-                    }
-                    else
-                    {
-                        logger.logDebug(
-                            "There was an error while writing enumeration entries to the"
-                            " database.");
-                        rc = SQLITEDB_ERROR;
-                    }
-                }
-                else
-                {
-                    logger.logDebug(
-                        "There was an error while writing field entries to the"
-                        " database.");
+/**
+ *@brief Copies the main database of source over the main database of destination with
+ *the online backup API, SQLITEDB_BACKUP_STEP_PAGES pages at a time.
+ */
+int SQLiteDB::copyDatabase(sqlite3* source, sqlite3* destination)
+{
+    int             rc     = SQLITEDB_OK;
+    sqlite3_backup* backup = sqlite3_backup_init(destination, "main", source, "main");
 
-                    rc = SQLITEDB_ERROR;
-                }
-            }
-        }
+    if (backup == nullptr)
+    {
+        logger.logError("Failed to start copying the database. %s", sqlite3_errmsg(destination));
+        return SQLITEDB_ERROR;
     }
-    else
+
+    int stepRc = SQLITE_OK;
+
+    while (SQLITE_OK == stepRc)
     {
-        logger.logDebug("There was an error while writing elf entries to the database.");
+        stepRc = sqlite3_backup_step(backup, SQLITEDB_BACKUP_STEP_PAGES);
+    }
 
+    if (sqlite3_backup_finish(backup) != SQLITE_OK || stepRc != SQLITE_DONE)
+    {
+        logger.logError("Failed to copy the database. %s", sqlite3_errmsg(destination));
         rc = SQLITEDB_ERROR;
     }
 
@@ -448,1136 +347,1673 @@ int SQLiteDB::write(ElfFile& inElf)
 }
 
 /**
- *@brief Iterates through all of the ELF entries in
- *inElf and writes each one to the "elfs" table.
- *
- *@param inElf The elf that has the Elf data.
+ *@brief Establish a new connection to the database at databaseName.
+ *If the file does not yet exist, this will create it.
  *
- *@return Returns SQLITEDB_OK if all of the elf entries are written to the
- *database successfully. If the method fails to write at least one of the
- *elf entries to the database, then SQLITEDB_ERROR is returned.
+ *@return Returns SQLITE_OK if it is able to open the database successfully.
+ *If opening the database fails, then SQLITESTRUCTURE_ERROR is returned.
  */
-int SQLiteDB::writeElfToDatabase(ElfFile& inElf)
+int SQLiteDB::openDatabase(std::string& fileName)
 {
-    int         rc           = SQLITEDB_OK;
-    char*       errorMessage = NULL;
-
-    /*
-     * @todo I want to store these SQLite magical values into MACROS,
-     * but I'm not sure what is the best way to do that without it being
-     * messy.
-     */
-    std::string writeElfQuery{};
-
-    std::string checksum = inElf.getMD5();
-    writeElfQuery +=
-        "INSERT INTO elfs(name, md5, little_endian) "
-        "VALUES(\"";
-    writeElfQuery += inElf.getName();
-    writeElfQuery += "\",";
-    writeElfQuery += "\"";
-    writeElfQuery += checksum;
-    writeElfQuery += "\",";
-    writeElfQuery += std::to_string(inElf.isLittleEndian() ? SQLiteDB_TRUE : SQLiteDB_FALSE);
-    writeElfQuery += ");";
-
-    logger.logDebug("Sending \"%s\" query to database.", writeElfQuery.c_str());
-
-    rc = sqlite3_exec(database, writeElfQuery.c_str(), NULL, NULL, &errorMessage);
+    int rc = sqlite3_open(fileName.c_str(), &database);
 
     if (SQLITE_OK == rc)
     {
-        logger.logDebug(
-            "Elf values were written to the elfs schema with "
-            "SQLITE_OK status.");
-        /*Write the id to this elf so that other tables can use it as
-         *a foreign key */
-
-        sqlite3_int64 lastRowId = sqlite3_last_insert_rowid(database);
-        inElf.setId(lastRowId);
+        JUICER_LOG_DEBUG(logger, "Created the database with OK status");
     }
     else
     {
-        if (sqlite3_extended_errcode(database) == SQLITE_CONSTRAINT_UNIQUE)
-        {
-            logger.logDebug("%s.", errorMessage);
-            rc = SQLITE_OK;
-        }
-        else
-        {
-            logger.logDebug("There was an error while writing data to the elfs table.");
-            logger.logDebug("%s.", errorMessage);
-            rc = SQLITEDB_ERROR;
-        }
+        rc = SQLITEDB_ERROR;
+        logger.logError("Failed to create the database with SQLITEDB_ERROR status.", sqlite3_errmsg(database));
     }
 
     return rc;
 }
 
 /**
- *@brief Iterates through all of the ELF entries in
- *inElf and writes each one to the "elfs" table.
+ *@brief Writes all the data such as Elf, Symbols and elfs entries
+ *to the SQLite database.
  *
- *@param inElf The elf that has the Elf data.
+ *All of the tables are written inside of a single transaction. If any of them
+ *fails, the transaction is rolled back so a failed write never leaves a partial
+ *elf behind in the database.
  *
- *@return Returns SQLITEDB_OK if all of the elf entries are written to the
- *database successfully. If the method fails to write at least one of the
- *elf entries to the database, then SQLITEDB_ERROR is returned.
+ *All of the symbols, with their fields and enumerations, go through writeBatch as one
+ *batch. beginElf writes them in many, on another thread, while Juicer is still reading inElf.
+ *
+ *The tables of a new database do not have their unique indexes yet. The first write into it
+ *skips the rows that would violate them itself, so every INSERT only appends to its table,
+ *and builds all of the indexes once before it commits. Every later write finds the indexes
+ *and relies on them to skip the rows that are already in the database.
+ *
+ *@param inElf The elf that contains all of the DWARF and ELF data.
+ *
+ *@return SQLITE_OK if it was able to write the all of data to the database
+ *successfully. Please note that attempting to write an entry that already exists is NOT an error
+ *in juicer's context; if a user attempts to write a record that already exists, this function returns SQLITE_OK.
+ *Otherwise, this method returns SQLITEDB_ERROR.
  */
-int SQLiteDB::writeMacrosToDatabase(ElfFile& inElf)
+int SQLiteDB::write(ElfFile& inElf)
 {
-    int rc = SQLITEDB_OK;
-    for (auto macro : inElf.getDefineMacros())
-    {
-        /*
-         * @todo I want to store these SQLite magical values into MACROS,
-         * but I'm not sure what is the best way to do that without it being
-         * messy.
-         */
+    int rc = startElf(inElf);
 
-        // Create a SQL statement with placeholders
-        sqlite3_stmt* stmt;
-        const char*   sql = "INSERT INTO macros (name, value) VALUES (?, ?);";
+    if (SQLITEDB_OK == rc)
+    {
+        SymbolBatch batch{};
 
-        // Prepare the SQL statement
-        rc                = sqlite3_prepare_v2(database, sql, -1, &stmt, NULL);
+        addSymbolsToBatch(inElf, 0, batch);
+        rc = writeBatch(batch);
+    }
 
-        if (rc != SQLITE_OK)
-        {
-            std::cerr << "SQL error: " << sqlite3_errmsg(database) << std::endl;
-        }
-        else
-        {
-            // Bind values to placeholders
-            sqlite3_bind_text(stmt, 1, macro.getName().c_str(), -1, SQLITE_STATIC);
-            sqlite3_bind_text(stmt, 2, macro.getValue().c_str(), -1, SQLITE_STATIC);
+    return finishElf(inElf, rc);
+}
 
-            // Execute the SQL statement
-            if (sqlite3_step(stmt) != SQLITE_DONE)
-            {
-                const char* errorMessage = sqlite3_errmsg(database);
-                if (SQLITE_OK == rc)
-                {
-                    logger.logDebug(
-                        "Elf values were written to the macros schema with "
-                        "SQLITE_OK status.");
+/**
+ *@brief Logs the outcome of writing tableName in write().
+ */
+void SQLiteDB::logWriteStatus(int rc, const char* tableName)
+{
+    if (SQLITEDB_OK == rc)
+    {
+        JUICER_LOG_DEBUG(logger, "Entries were written to the %s schema with SQLITE_OK status.", tableName);
+    }
+    else
+    {
+        logger.logError("There was an error while writing %s entries to the database.", tableName);
+    }
+}
+
+/**
+ *@brief Starts the transaction that write() runs in.
+ *
+ *The transaction takes the write lock right away, so no other connection can insert rows
+ *between loadNextIds reading the largest ids and write() using the ones after them.
+ *
+ *@return Returns SQLITEDB_OK if the transaction was started. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::beginTransaction(void)
+{
+    int   rc           = SQLITEDB_OK;
+    char* errorMessage = NULL;
+
+    rc                 = sqlite3_exec(database, "BEGIN IMMEDIATE TRANSACTION;", NULL, NULL, &errorMessage);
+
+    if (SQLITE_OK != rc)
+    {
+        logger.logError("Failed to begin transaction:%s.", errorMessage);
+        sqlite3_free(errorMessage);
+        rc = SQLITEDB_ERROR;
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Commits the transaction started by beginTransaction().
+ *
+ *@return Returns SQLITEDB_OK if the transaction was committed. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::commitTransaction(void)
+{
+    int   rc           = SQLITEDB_OK;
+    char* errorMessage = NULL;
+
+    rc                 = sqlite3_exec(database, "COMMIT;", NULL, NULL, &errorMessage);
+
+    if (SQLITE_OK != rc)
+    {
+        logger.logError("Failed to commit transaction:%s.", errorMessage);
+        sqlite3_free(errorMessage);
+        rollbackTransaction();
+        rc = SQLITEDB_ERROR;
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Throws away everything written since beginTransaction().
+ */
+void SQLiteDB::rollbackTransaction(void)
+{
+    char* errorMessage = NULL;
+
+    /* The id maps may hold ids of rows that are about to be rolled back. */
+    existingIdsLoaded  = false;
+
+    if (SQLITE_OK != sqlite3_exec(database, "ROLLBACK;", NULL, NULL, &errorMessage))
+    {
+        logger.logError("Failed to roll back transaction:%s.", errorMessage);
+        sqlite3_free(errorMessage);
+    }
+    else
+    {
+        logger.logWarning("The transaction was rolled back. Nothing was written to the database.");
+    }
+}
+
+/**
+ *@brief Reads the ids of every symbol and artifact that is already in the database
+ *into symbolIds and artifactIds, and the target_symbol of every symbol that has one into targetSymbolIds.
+ *
+ *addSymbolsToBatch resolves existing rows through these maps instead of querying
+ *the database for every symbol, and only batches the rows that are new.
+ *The maps are loaded by the first write() and kept up to date as rows are inserted, so writing
+ *many elfs into the same database only reads the tables once. They are loaded again after a
+ *rollback so a failed write never leaves stale ids behind.
+ *
+ *@return Returns SQLITEDB_OK if both tables were read. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::loadExistingIds(void)
+{
+    sqlite3_stmt* stmt = NULL;
+    int           rc   = prepareStatement("SELECT id, name, target_symbol FROM symbols;", &stmt);
+
+    symbolIds.clear();
+    targetSymbolIds.clear();
+    artifactIds.clear();
+
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::count(STATS_COUNTER_SQL_STATEMENTS);
+
+        while (SQLITE_ROW == (rc = sqlite3_step(stmt)))
+        {
+            symbolIds[InternedString{(const char*)sqlite3_column_text(stmt, 1)}] = sqlite3_column_int64(stmt, 0);
+
+            if (sqlite3_column_type(stmt, 2) != SQLITE_NULL)
+            {
+                targetSymbolIds[sqlite3_column_int64(stmt, 0)] = sqlite3_column_int64(stmt, 2);
+            }
+        }
+
+        rc = SQLITE_DONE == rc ? SQLITEDB_OK : SQLITEDB_ERROR;
+
+        sqlite3_finalize(stmt);
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        rc = prepareStatement("SELECT id, path, md5 FROM artifacts;", &stmt);
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::count(STATS_COUNTER_SQL_STATEMENTS);
+
+        while (SQLITE_ROW == (rc = sqlite3_step(stmt)))
+        {
+            artifactIds[InternedString{(const char*)sqlite3_column_text(stmt, 1)}][(const char*)sqlite3_column_text(stmt, 2)] =
+                sqlite3_column_int64(stmt, 0);
+        }
+
+        rc = SQLITE_DONE == rc ? SQLITEDB_OK : SQLITEDB_ERROR;
+
+        sqlite3_finalize(stmt);
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        JUICER_LOG_DEBUG(logger, "Found %u symbols and %u artifact paths in the database.", symbolIds.size(), artifactIds.size());
+        existingIdsLoaded = true;
+    }
+    else
+    {
+        logger.logError("There was an error while reading the existing symbols and artifacts:%s.", sqlite3_errmsg(database));
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Reads the largest id of the artifacts, symbols and fields tables, so that write()
+ *can give new rows their ids itself instead of reading each one back from SQLite.
+ *
+ *The ids are the same ones SQLite would have picked for those rows. They are known before
+ *a row is inserted, so for instance every new symbol has its id before the first of them
+ *is written, and no table has to wait for the rows of another to learn their ids.
+ *
+ *@return Returns SQLITEDB_OK if the ids were read. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::loadNextIds(void)
+{
+    sqlite3_stmt* stmt = NULL;
+    int           rc   = prepareStatement(
+        "SELECT (SELECT IFNULL(MAX(id), 0) FROM artifacts), (SELECT IFNULL(MAX(id), 0) FROM symbols), (SELECT IFNULL(MAX(id), 0) FROM fields);", &stmt);
+
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::count(STATS_COUNTER_SQL_STATEMENTS);
+
+        if (SQLITE_ROW == sqlite3_step(stmt))
+        {
+            nextArtifactId = sqlite3_column_int64(stmt, 0) + 1;
+            nextSymbolId   = sqlite3_column_int64(stmt, 1) + 1;
+            nextFieldId    = sqlite3_column_int64(stmt, 2) + 1;
+        }
+        else
+        {
+            logger.logError("Failed to read the largest ids of the database:%s.", sqlite3_errmsg(database));
+            rc = SQLITEDB_ERROR;
+        }
+
+        sqlite3_finalize(stmt);
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Sets bulkLoad if the unique indexes of the tables have not been built yet.
+ *
+ *Databases made by older versions of juicer have them as constraints of their tables, which
+ *also makes an index for elfs. A database made by this version has no index for elfs
+ *until createUniqueIndexes commits.
+ *
+ *@return Returns SQLITEDB_OK if the indexes were checked. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::checkUniqueIndexes(void)
+{
+    sqlite3_stmt* stmt = NULL;
+    int           rc   = prepareStatement("SELECT COUNT(*) FROM sqlite_master WHERE type = 'index' AND tbl_name = 'elfs';", &stmt);
+
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::count(STATS_COUNTER_SQL_STATEMENTS);
+
+        if (SQLITE_ROW == sqlite3_step(stmt))
+        {
+            bulkLoad = sqlite3_column_int(stmt, 0) == 0;
+        }
+        else
+        {
+            logger.logError("Failed to look up the indexes of the database:%s.", sqlite3_errmsg(database));
+            rc = SQLITEDB_ERROR;
+        }
+
+        sqlite3_finalize(stmt);
+    }
+
+    if (SQLITEDB_OK == rc && bulkLoad)
+    {
+        JUICER_LOG_DEBUG(logger, "The database has no unique indexes yet. They will be built once this elf is written.");
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Builds the unique indexes of every table. Runs inside the transaction of write(), so
+ *the database is never committed without them.
+ *
+ *@return Returns SQLITEDB_OK if all of the indexes were built. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::createUniqueIndexes(void)
+{
+    char* errorMessage = NULL;
+    int   rc           = sqlite3_exec(database, CREATE_UNIQUE_INDEXES, NULL, NULL, &errorMessage);
+
+    Stats::count(STATS_COUNTER_SQL_STATEMENTS);
+
+    if (SQLITE_OK == rc)
+    {
+        JUICER_LOG_DEBUG(logger, "Built the unique indexes of the database.");
+    }
+    else
+    {
+        logger.logError("Failed to build the unique indexes of the database:%s.", errorMessage);
+        sqlite3_free(errorMessage);
+        rc = SQLITEDB_ERROR;
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Compiles sql into stmt. The write methods prepare each of their INSERT
+ *statements once and then bind, step and reset it for every row.
+ *
+ *@return Returns SQLITEDB_OK if the statement compiled. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::prepareStatement(const char* sql, sqlite3_stmt** stmt)
+{
+    int rc = sqlite3_prepare_v2(database, sql, -1, stmt, NULL);
+
+    if (SQLITE_OK != rc)
+    {
+        logger.logError("Failed to prepare \"%s\":%s.", sql, sqlite3_errmsg(database));
+        sqlite3_finalize(*stmt);
+        *stmt = NULL;
+        rc    = SQLITEDB_ERROR;
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Runs the INSERT statement stmt that has all of its values bound, and resets
+ *it so it can be bound for the next row.
+ *
+ *@param tableName The table stmt inserts into. Only used for logging.
+ *
+ *@return Returns SQLITE_DONE if the row was inserted, in which case sqlite3_last_insert_rowid
+ *is the id of the new row. Returns SQLITE_CONSTRAINT if the row already exists, which is not an error
+ *in juicer's context. Otherwise, SQLITEDB_ERROR is returned.
+ */
+int SQLiteDB::stepStatement(sqlite3_stmt* stmt, const char* tableName)
+{
+    int rc = sqlite3_step(stmt);
+
+    Stats::count(STATS_COUNTER_SQL_STATEMENTS);
+
+    if (SQLITE_DONE != rc)
+    {
+        if (sqlite3_extended_errcode(database) == SQLITE_CONSTRAINT_UNIQUE)
+        {
+            JUICER_LOG_DEBUG(logger, "%s.", sqlite3_errmsg(database));
+            rc = SQLITE_CONSTRAINT;
+        }
+        else
+        {
+            logger.logError("There was an error while writing data to the %s table:%s.", tableName, sqlite3_errmsg(database));
+            rc = SQLITEDB_ERROR;
+        }
+    }
+
+    sqlite3_reset(stmt);
+
+    return rc;
+}
+
+/**
+ *@brief Runs the INSERT statement stmt like stepStatement. stmt may end in onConflictClause.
+ *
+ *@return Also returns SQLITE_CONSTRAINT if ON CONFLICT DO NOTHING skipped the row, so callers
+ *see a row that already exists the same way whichever version of SQLite they run on.
+ */
+int SQLiteDB::stepInsert(sqlite3_stmt* stmt, const char* tableName)
+{
+    int rc = stepStatement(stmt, tableName);
+
+    if (SQLITE_DONE == rc && sqlite3_changes(database) == 0)
+    {
+        JUICER_LOG_DEBUG(logger, "The row already is in the %s table.", tableName);
+        rc = SQLITE_CONSTRAINT;
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Iterates through all of the ELF entries in
+ *inElf and writes each one to the "elfs" table.
+ *
+ *An elf that is already in the table, because it is being juiced again after it
+ *changed, keeps its row and id; its checksum and endianness are updated instead, and
+ *the rows of its previous build are deleted. See deleteElfRows.
+ *
+ *@param inElf The elf that has the Elf data.
+ *
+ *@return Returns SQLITEDB_OK if all of the elf entries are written to the
+ *database successfully. If the method fails to write at least one of the
+ *elf entries to the database, then SQLITEDB_ERROR is returned.
+ */
+int SQLiteDB::writeElfToDatabase(ElfFile& inElf)
+{
+    sqlite3_stmt* stmt = NULL;
+    int           rc   = prepareStatement("INSERT INTO elfs(name, md5, checksum_algorithm, little_endian) VALUES(?, ?, ?, ?);", &stmt);
+
+    if (SQLITEDB_OK == rc)
+    {
+        sqlite3_bind_text(stmt, 1, inElf.getName().c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_text(stmt, 2, inElf.getMD5().c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_text(stmt, 3, inElf.getChecksumAlgorithm().c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_int(stmt, 4, inElf.isLittleEndian() ? SQLiteDB_TRUE : SQLiteDB_FALSE);
+
+        rc = stepStatement(stmt, "elfs");
+
+        if (SQLITE_DONE == rc)
+        {
+            /*Write the id to this elf so that other tables can use it as
+             *a foreign key */
+            inElf.setId(sqlite3_last_insert_rowid(database));
+        }
+
+        sqlite3_finalize(stmt);
+    }
+
+    if (SQLITE_CONSTRAINT == rc)
+    {
+        /* RETURNING needs SQLite 3.35, which is newer than what Ubuntu 18.04 and 20.04 ship. */
+        rc = prepareStatement("UPDATE elfs SET md5 = ?, checksum_algorithm = ?, little_endian = ?, date = CURRENT_TIMESTAMP WHERE name = ?;", &stmt);
+
+        if (SQLITEDB_OK == rc)
+        {
+            sqlite3_bind_text(stmt, 1, inElf.getMD5().c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_text(stmt, 2, inElf.getChecksumAlgorithm().c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_int(stmt, 3, inElf.isLittleEndian() ? SQLiteDB_TRUE : SQLiteDB_FALSE);
+            sqlite3_bind_text(stmt, 4, inElf.getName().c_str(), -1, SQLITE_TRANSIENT);
+
+            rc = stepStatement(stmt, "elfs");
+
+            sqlite3_finalize(stmt);
+        }
+
+        if (SQLITE_DONE == rc)
+        {
+            rc = prepareStatement("SELECT id FROM elfs WHERE name = ?;", &stmt);
+        }
+
+        if (SQLITEDB_OK == rc)
+        {
+            sqlite3_bind_text(stmt, 1, inElf.getName().c_str(), -1, SQLITE_TRANSIENT);
+
+            Stats::count(STATS_COUNTER_SQL_STATEMENTS);
+
+            if (SQLITE_ROW == sqlite3_step(stmt))
+            {
+                inElf.setId(sqlite3_column_int64(stmt, 0));
+                JUICER_LOG_DEBUG(logger, "Updated the existing entry of elf %s.", inElf.getName().c_str());
+            }
+            else
+            {
+                logger.logError("Failed to read the id of elf %s:%s.", inElf.getName().c_str(), sqlite3_errmsg(database));
+                rc = SQLITEDB_ERROR;
+            }
+
+            sqlite3_finalize(stmt);
+        }
+
+        if (SQLITEDB_OK == rc)
+        {
+            rc = deleteElfRows(inElf.getId());
+        }
+        else
+        {
+            rc = SQLITEDB_ERROR;
+        }
+    }
+
+    return SQLITEDB_ERROR == rc ? SQLITEDB_ERROR : SQLITEDB_OK;
+}
+
+/**
+ *@brief Deletes the variables, ELF sections and ELF symbol table entries the previous build of the
+ *elf elfId left behind, so writing it again replaces them instead of adding to them. Those rows
+ *only belong to one elf. Symbols, fields and the rest can be shared with other elfs and are kept.
+ *
+ *@return Returns SQLITEDB_OK if the rows were deleted. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::deleteElfRows(sqlite3_int64 elfId)
+{
+    const char* tableNames[] = {"variables", "elf_sections", "elf_symbol_table"};
+    int         rc           = SQLITEDB_OK;
+
+    for (const char* tableName : tableNames)
+    {
+        sqlite3_stmt* stmt = NULL;
+        std::string   sql  = std::string{"DELETE FROM "} + tableName + " WHERE elf = ?;";
+
+        rc                 = prepareStatement(sql.c_str(), &stmt);
+
+        if (SQLITEDB_OK == rc)
+        {
+            sqlite3_bind_int64(stmt, 1, elfId);
+
+            Stats::count(STATS_COUNTER_SQL_STATEMENTS);
+
+            if (SQLITE_DONE == sqlite3_step(stmt))
+            {
+                JUICER_LOG_DEBUG(logger, "Deleted %d rows of the previous build from the %s table.", sqlite3_changes(database), tableName);
+            }
+            else
+            {
+                logger.logError("Failed to delete the rows of the previous build from the %s table:%s.", tableName, sqlite3_errmsg(database));
+                rc = SQLITEDB_ERROR;
+            }
+
+            sqlite3_finalize(stmt);
+        }
+
+        if (SQLITEDB_OK != rc)
+        {
+            break;
+        }
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Checks whether the elf called name is already in the database with the given checksum.
+ *
+ *@return true if the elfs table has an entry for name whose checksum was made with algorithm
+ *and is equal to checksum. Otherwise, and if the query fails, false.
+ */
+bool SQLiteDB::hasElf(const std::string& name, const std::string& checksum, const std::string& algorithm)
+{
+    sqlite3_stmt* stmt  = NULL;
+    bool          found = false;
+
+    if (SQLITEDB_OK == prepareStatement("SELECT id FROM elfs WHERE name = ? AND md5 = ? AND checksum_algorithm = ?;", &stmt))
+    {
+        sqlite3_bind_text(stmt, 1, name.c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_text(stmt, 2, checksum.c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_text(stmt, 3, algorithm.c_str(), -1, SQLITE_TRANSIENT);
+
+        found = SQLITE_ROW == sqlite3_step(stmt);
+        Stats::count(STATS_COUNTER_SQL_STATEMENTS);
+
+        sqlite3_finalize(stmt);
+    }
+
+    return found;
+}
+
+/**
+ *@brief Iterates through all of the macro entries in
+ *inElf and writes each one to the "macros" table.
+ *
+ *ElfFile keeps one of each macro, so the first write into a new database does not
+ *have to skip any of them itself.
+ *
+ *@param inElf The elf that has the Elf data.
+ *
+ *@return Returns SQLITEDB_OK if all of the macro entries are written to the
+ *database successfully. If the method fails to write at least one of the
+ *macro entries to the database, then SQLITEDB_ERROR is returned.
+ */
+int SQLiteDB::writeMacrosToDatabase(ElfFile& inElf)
+{
+    sqlite3_stmt* stmt = NULL;
+    std::string   sql  = "INSERT INTO macros(name, value) VALUES(?, ?)" + onConflictClause + ";";
+    int           rc   = prepareStatement(sql.c_str(), &stmt);
+
+    if (SQLITEDB_OK == rc)
+    {
+        for (auto&& macro : inElf.getDefineMacros())
+        {
+            sqlite3_bind_text(stmt, 1, macro.getName().c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_text(stmt, 2, macro.getValue().c_str(), -1, SQLITE_STATIC);
+
+            rc = stepInsert(stmt, "macros");
+
+            if (SQLITEDB_ERROR == rc)
+            {
+                break;
+            }
+        }
+
+        sqlite3_finalize(stmt);
+    }
+
+    return SQLITEDB_ERROR == rc ? SQLITEDB_ERROR : SQLITEDB_OK;
+}
+
+/**
+ *@brief Iterates through all of the variable entries in
+ *inElf and writes each one to the "variables" table.
+ *
+ *@param inElf The elf that has the Elf data.
+ *
+ *@return Returns SQLITEDB_OK if all of the variable entries are written to the
+ *database successfully. If the method fails to write at least one of the
+ *variable entries to the database, then SQLITEDB_ERROR is returned.
+ */
+int SQLiteDB::writeVariablesToDatabase(ElfFile& inElf)
+{
+    sqlite3_stmt* stmt = NULL;
+    std::string   sql  = "INSERT INTO variables(name, elf, type, short_description, long_description) VALUES(?, ?, ?, ?, ?)" + onConflictClause + ";";
+    int           rc   = prepareStatement(sql.c_str(), &stmt);
+
+    /* Names of the variables written so far, by type. Only needed while there is no unique index to skip them. */
+    std::unordered_map<sqlite3_int64, std::unordered_set<std::string>> writtenNames{};
+
+    if (SQLITEDB_OK == rc)
+    {
+        for (auto&& variable : inElf.getVariables())
+        {
+            if (bulkLoad && !writtenNames[variable.getType().getId()].insert(variable.getName()).second)
+            {
+                continue;
+            }
+
+            sqlite3_bind_text(stmt, 1, variable.getName().c_str(), -1, SQLITE_TRANSIENT);
+            sqlite3_bind_int64(stmt, 2, variable.getElf().getId());
+            sqlite3_bind_int64(stmt, 3, variable.getType().getId());
+            sqlite3_bind_text(stmt, 4, variable.getShortDescription().c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_text(stmt, 5, variable.getLongDescription().c_str(), -1, SQLITE_STATIC);
+
+            rc = stepInsert(stmt, "variables");
+
+            if (SQLITEDB_ERROR == rc)
+            {
+                break;
+            }
+        }
+
+        sqlite3_finalize(stmt);
+    }
+
+    return SQLITEDB_ERROR == rc ? SQLITEDB_ERROR : SQLITEDB_OK;
+}
+
+/**
+ *@brief Iterates through all of the section headers in
+ *inElf and writes each one to the "elf_sections" table.
+ *
+ *@param inElf The elf that has the Elf data.
+ *
+ *@return Returns SQLITEDB_OK if all of the section entries are written to the
+ *database successfully. If the method fails to write at least one of the
+ *section entries to the database, then SQLITEDB_ERROR is returned.
+ */
+int SQLiteDB::writeElfSectionsToDatabase(ElfFile& inElf)
+{
+    sqlite3_stmt* stmt = NULL;
+
+    /**
+     *@todo Not sure if I should make a seperation in the db between 32-bit and 64-bit sections...
+     */
+    int           rc   = prepareStatement(
+        "INSERT INTO elf_sections"
+                  "(name, elf, type, flags, address, file_offset, size, link, info, address_alignment, entry_size ) "
+                  "VALUES(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);",
+        &stmt);
+
+    if (SQLITEDB_OK != rc)
+    {
+        return rc;
+    }
+
+    switch (inElf.getElfClass())
+    {
+        case ELFCLASS32:
+        {
+            for (auto&& elf32Section : inElf.getElf32Headers())
+            {
+                sqlite3_bind_int64(stmt, 1, elf32Section.sh_name);
+                sqlite3_bind_int64(stmt, 2, inElf.getId());
+                sqlite3_bind_int64(stmt, 3, elf32Section.sh_type);
+                sqlite3_bind_int64(stmt, 4, elf32Section.sh_flags);
+                sqlite3_bind_int64(stmt, 5, elf32Section.sh_addr);
+                sqlite3_bind_int64(stmt, 6, elf32Section.sh_offset);
+                sqlite3_bind_int64(stmt, 7, elf32Section.sh_size);
+                sqlite3_bind_int64(stmt, 8, elf32Section.sh_link);
+                sqlite3_bind_int64(stmt, 9, elf32Section.sh_info);
+                sqlite3_bind_int64(stmt, 10, elf32Section.sh_addralign);
+                sqlite3_bind_int64(stmt, 11, elf32Section.sh_entsize);
+
+                rc = stepStatement(stmt, "elf_sections");
+
+                if (SQLITEDB_ERROR == rc)
+                {
+                    break;
                 }
-                else
+            }
+
+            break;
+        }
+        case ELFCLASS64:
+        {
+            for (auto&& elf64Section : inElf.getElf64Headers())
+            {
+                sqlite3_bind_int64(stmt, 1, elf64Section.sh_name);
+                sqlite3_bind_int64(stmt, 2, inElf.getId());
+                sqlite3_bind_int64(stmt, 3, elf64Section.sh_type);
+                sqlite3_bind_int64(stmt, 4, elf64Section.sh_flags);
+                sqlite3_bind_int64(stmt, 5, elf64Section.sh_addr);
+                sqlite3_bind_int64(stmt, 6, elf64Section.sh_offset);
+                sqlite3_bind_int64(stmt, 7, elf64Section.sh_size);
+                sqlite3_bind_int64(stmt, 8, elf64Section.sh_link);
+                sqlite3_bind_int64(stmt, 9, elf64Section.sh_info);
+                sqlite3_bind_int64(stmt, 10, elf64Section.sh_addralign);
+                sqlite3_bind_int64(stmt, 11, elf64Section.sh_entsize);
+
+                rc = stepStatement(stmt, "elf_sections");
+
+                if (SQLITEDB_ERROR == rc)
                 {
-                    if (sqlite3_extended_errcode(database) == SQLITE_CONSTRAINT_UNIQUE)
-                    {
-                        logger.logDebug("%s.", errorMessage);
-                        rc = SQLITE_OK;
-                    }
-                    else
-                    {
-                        logger.logDebug("There was an error while writing data to the elfs table.");
-                        logger.logDebug("%s.", errorMessage);
-                        rc = SQLITEDB_ERROR;
-                    }
+                    break;
                 }
             }
 
-            // Finalize the statement
-            rc = sqlite3_finalize(stmt);
-            if (rc != SQLITE_OK)
+            break;
+        }
+    }
+
+    sqlite3_finalize(stmt);
+
+    return SQLITEDB_ERROR == rc ? SQLITEDB_ERROR : SQLITEDB_OK;
+}
+
+/**
+ *@brief Iterates through all of the ELF symbol table entries in
+ *inElf and writes each one to the "elf_symbol_table" table.
+ *
+ *@param inElf The elf that has the Elf data.
+ *
+ *@return Returns SQLITEDB_OK if all of the symbol table entries are written to the
+ *database successfully. If the method fails to write at least one of the
+ *symbol table entries to the database, then SQLITEDB_ERROR is returned.
+ */
+int SQLiteDB::writeElfSymboltableSymbolsToDatabase(ElfFile& inElf)
+{
+    sqlite3_stmt* stmt = NULL;
+    int           rc   = prepareStatement(
+        "INSERT INTO elf_symbol_table"
+                  "(name, elf, value, size, info, other, section_index, file_offset, string_table_file_offset ) "
+                  "VALUES(?, ?, ?, ?, ?, ?, ?, ?, ?);",
+        &stmt);
+
+    if (SQLITEDB_OK != rc)
+    {
+        return rc;
+    }
+
+    switch (inElf.getElfClass())
+    {
+        case ELFCLASS32:
+        {
+            for (auto&& elf32Symbol : inElf.getElf32SymbolTable())
             {
-                logger.logDebug("There was an error while finalizing the sql statement for encodings table.");
+                const Elf32_Sym& symbol = elf32Symbol.getSymbol();
+
+                sqlite3_bind_int64(stmt, 1, symbol.st_name);
+                sqlite3_bind_int64(stmt, 2, inElf.getId());
+                sqlite3_bind_int64(stmt, 3, symbol.st_value);
+                sqlite3_bind_int64(stmt, 4, symbol.st_size);
+                sqlite3_bind_int64(stmt, 5, symbol.st_info);
+                sqlite3_bind_int64(stmt, 6, symbol.st_other);
+                sqlite3_bind_int64(stmt, 7, symbol.st_shndx);
+                sqlite3_bind_int64(stmt, 8, elf32Symbol.getFileOffset());
+                sqlite3_bind_int64(stmt, 9, elf32Symbol.getStrTableFileOffset());
+
+                rc = stepStatement(stmt, "elf_symbol_table");
+
+                if (SQLITEDB_ERROR == rc)
+                {
+                    break;
+                }
             }
-            else
+            break;
+        }
+        case ELFCLASS64:
+        {
+            for (auto&& elf64Symbol : inElf.getElf64SymbolTable())
             {
-                // sqlite3_int64 lastRowId = sqlite3_last_insert_rowid(database);
+                const Elf64_Sym& symbol = elf64Symbol.getSymbol();
+
+                sqlite3_bind_int64(stmt, 1, symbol.st_name);
+                sqlite3_bind_int64(stmt, 2, inElf.getId());
+                sqlite3_bind_int64(stmt, 3, symbol.st_value);
+                sqlite3_bind_int64(stmt, 4, symbol.st_size);
+                sqlite3_bind_int64(stmt, 5, symbol.st_info);
+                sqlite3_bind_int64(stmt, 6, symbol.st_other);
+                sqlite3_bind_int64(stmt, 7, symbol.st_shndx);
+                sqlite3_bind_int64(stmt, 8, elf64Symbol.getFileOffset());
+                sqlite3_bind_int64(stmt, 9, elf64Symbol.getStrTableFileOffset());
+
+                rc = stepStatement(stmt, "elf_symbol_table");
+
+                if (SQLITEDB_ERROR == rc)
+                {
+                    break;
+                }
+            }
+            break;
+        }
+    }
+
+    sqlite3_finalize(stmt);
+
+    return SQLITEDB_ERROR == rc ? SQLITEDB_ERROR : SQLITEDB_OK;
+}
+
+/**
+ *@brief Starts the transaction that writes inElf into, and writes everything the rows of its
+ *symbols refer to: the elfs row and the encodings. Then prepares the INSERTs writeBatch runs.
+ *
+ *@return Returns SQLITEDB_OK if inElf is ready for writeBatch. Otherwise, SQLITEDB_ERROR,
+ *in which case finishElf still has to be called to roll the transaction back.
+ */
+int SQLiteDB::startElf(ElfFile& inElf)
+{
+    int rc = beginTransaction();
+
+    if (SQLITEDB_OK == rc && !existingIdsLoaded)
+    {
+        rc = loadExistingIds();
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        rc = checkUniqueIndexes();
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        rc = loadNextIds();
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::Timer timer{STATS_PHASE_DB_ELFS};
+
+        rc = writeElfToDatabase(inElf);
+        logWriteStatus(rc, "elfs");
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::Timer timer{STATS_PHASE_DB_ENCODINGS};
+
+        rc = writeEncodingsToDatabase(inElf);
+        logWriteStatus(rc, "encodings");
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        currentElfId             = inElf.getId();
+        currentChecksumAlgorithm = inElf.getChecksumAlgorithm();
+
+        rc                       = prepareInsertStatements();
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Writes the rest of inElf once all of its symbols have been through writeBatch, and
+ *commits the transaction startElf began. If rc is not SQLITEDB_OK, nothing else is written
+ *and the transaction is rolled back instead.
+ *
+ *@return Returns SQLITEDB_OK if inElf was committed. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::finishElf(ElfFile& inElf, int rc)
+{
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::Timer timer{STATS_PHASE_DB_MACROS};
+
+        rc = writeMacrosToDatabase(inElf);
+        logWriteStatus(rc, "macros");
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::Timer timer{STATS_PHASE_DB_SYMBOLS};
+
+        rc = writeTargetSymbolsToDatabase(inElf);
+
+        if (SQLITEDB_OK == rc)
+        {
+            rc = writeSymbolEncodingsToDatabase(inElf);
+        }
+
+        logWriteStatus(rc, "symbols");
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::Timer timer{STATS_PHASE_DB_VARIABLES};
+
+        rc = writeVariablesToDatabase(inElf);
+        logWriteStatus(rc, "variables");
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::Timer timer{STATS_PHASE_DB_ELF_SECTIONS};
+
+        rc = writeElfSectionsToDatabase(inElf);
+        logWriteStatus(rc, "elf_sections");
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::Timer timer{STATS_PHASE_DB_ELF_SYMBOL_TABLE};
+
+        rc = writeElfSymboltableSymbolsToDatabase(inElf);
+        logWriteStatus(rc, "elf_symbol_table");
+    }
+
+    if (SQLITEDB_OK == rc && bulkLoad)
+    {
+        Stats::Timer timer{STATS_PHASE_DB_INDEXES};
+
+        rc = createUniqueIndexes();
+    }
+
+    finalizeInsertStatements();
+    writtenFieldNames.clear();
+    writtenEnumerationNames.clear();
+    batchedSymbols = 0;
+    batchedFields.clear();
+    batchedEnumerations.clear();
+    batchedEncodingIds.clear();
+
+    if (SQLITEDB_OK == rc)
+    {
+        rc = commitTransaction();
+    }
+    else
+    {
+        rollbackTransaction();
+        rc = SQLITEDB_ERROR;
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Prepares the INSERTs writeBatch runs for every batch of the elf startElf began.
+ *
+ *@return Returns SQLITEDB_OK if all of them compiled. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::prepareInsertStatements(void)
+{
+    std::string fieldSql       = "INSERT INTO fields(id, symbol, name, byte_offset, type, little_endian, bit_size, bit_offset, long_description, short_description) "
+                                 "VALUES(?, ?, ?, ?, ?, ?, ?, ?, ?, ?)" + onConflictClause + ";";
+    std::string dimensionSql   = "INSERT INTO dimension_lists(field_id, dim_order, upper_bound) VALUES(?, ?, ?)" + onConflictClause + ";";
+    std::string enumerationSql = "INSERT INTO enumerations(symbol, value, name, long_description, short_description) VALUES(?, ?, ?, ?, ?)" + onConflictClause + ";";
+    int         rc             = prepareStatement("INSERT INTO artifacts(id, elf, path, md5, checksum_algorithm) VALUES(?, ?, ?, ?, ?);", &insertArtifactStmt);
+
+    if (SQLITEDB_OK == rc)
+    {
+        rc = prepareStatement(
+            "INSERT INTO symbols(id, elf, name, byte_size, encoding, artifact, long_description, short_description, target_symbol) "
+            "VALUES(?, ?, ?, ?, ?, ?, ?, ?, ?);",
+            &insertSymbolStmt);
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        rc = prepareStatement(fieldSql.c_str(), &insertFieldStmt);
+    }
+
+    if (SQLITEDB_OK == rc)
+    {
+        rc = prepareStatement(dimensionSql.c_str(), &insertDimensionStmt);
+    }
 
-                // inElf.encodingsMap.at(encoding.first).setId(lastRowId);
-            }
-        }
+    if (SQLITEDB_OK == rc)
+    {
+        rc = prepareStatement(enumerationSql.c_str(), &insertEnumerationStmt);
     }
 
     return rc;
 }
 
+void SQLiteDB::finalizeInsertStatements(void)
+{
+    sqlite3_finalize(insertArtifactStmt);
+    sqlite3_finalize(insertSymbolStmt);
+    sqlite3_finalize(insertFieldStmt);
+    sqlite3_finalize(insertDimensionStmt);
+    sqlite3_finalize(insertEnumerationStmt);
+
+    insertArtifactStmt    = nullptr;
+    insertSymbolStmt      = nullptr;
+    insertFieldStmt       = nullptr;
+    insertDimensionStmt   = nullptr;
+    insertEnumerationStmt = nullptr;
+}
+
 /**
- *@brief Iterates through all of the ELF entries in
- *inElf and writes each one to the "elfs" table.
- *
- *@param inElf The elf that has the Elf data.
+ *@brief Adds the rows of the symbols of inElf from first on, and of their fields and
+ *enumerations, to batch.
  *
- *@return Returns SQLITEDB_OK if all of the elf entries are written to the
- *database successfully. If the method fails to write at least one of the
- *elf entries to the database, then SQLITEDB_ERROR is returned.
+ *Every artifact and symbol that is not in the database yet gets its id here, before any row is
+ *written, so the rows already hold the ids of the artifacts, encodings, types and target symbols
+ *they refer to. Those are always in the batch or in an earlier one, because Juicer adds a type
+ *to the elf before anything that refers to it. This is the only part of writing a symbol that
+ *looks at inElf, so Juicer can keep adding to it while writeBatch writes the rows.
  */
-int SQLiteDB::writeVariablesToDatabase(ElfFile& inElf)
+void SQLiteDB::addSymbolsToBatch(ElfFile& inElf, size_t first, SymbolBatch& batch)
 {
-    int   rc           = SQLITEDB_OK;
-    char* errorMessage = NULL;
+    std::vector<Symbol*>& symbols = inElf.getSymbols();
+    std::vector<Symbol*>  newSymbols{};
 
-    for (auto variable : inElf.getVariables())
+    for (size_t i = first; i < symbols.size(); i++)
     {
-        inElf.getInitializedSymbolData();
+        Symbol*     symbol  = symbols[i];
+        Artifact&   ar      = symbol->getArtifact();
+        std::string md5     = ar.getMD5();
 
-        /*
-         * @todo I want to store these SQLite magical values into MACROS,
-         * but I'm not sure what is the best way to do that without it being
-         * messy.
+        /**
+         *First check if the artifact and the symbol already exist in the database.
+         *If they do we don't need to write them. In that case, all we need is
+         *to get their ids which will be used by other tables as a foreign key.
          */
-        std::string writeVariableQuery{};
-
-        writeVariableQuery +=
-            "INSERT INTO variables(name, elf, type, short_description, long_description) "
-            "VALUES(";
-        writeVariableQuery += "\"";
-        writeVariableQuery += variable.getName();
-        writeVariableQuery += "\"";
-        writeVariableQuery += ",";
-        writeVariableQuery += std::to_string(variable.getElf().getId());
-
-        writeVariableQuery += ",";
-        writeVariableQuery += std::to_string(variable.getType().getId());
+        auto        pathIds = artifactIds.find(ar.getInternedFilePath());
 
-        writeVariableQuery += ",";
-
-        writeVariableQuery += "\"";
-        writeVariableQuery += variable.getShortDescription();
-        writeVariableQuery += "\"";
-
-        writeVariableQuery += ",";
-        writeVariableQuery += "\"";
-        writeVariableQuery += variable.getLongDescription();
-        writeVariableQuery += "\"";
-
-        writeVariableQuery += ");";
+        if (pathIds != artifactIds.end() && pathIds->second.find(md5) != pathIds->second.end())
+        {
+            ar.setId(pathIds->second.at(md5));
+        }
+        else
+        {
+            ar.setId(nextArtifactId++);
+            artifactIds[ar.getInternedFilePath()][md5] = ar.getId();
 
-        logger.logDebug("Sending \"%s\" query to database.", writeVariableQuery.c_str());
+            batch.artifacts.push_back(ArtifactRow{ar.getId(), ar.getInternedFilePath(), md5});
+        }
 
-        rc = sqlite3_exec(database, writeVariableQuery.c_str(), NULL, NULL, &errorMessage);
+        auto existingId = symbolIds.find(symbol->getInternedName());
 
-        if (SQLITE_OK == rc)
+        if (existingId != symbolIds.end())
         {
-            logger.logDebug(
-                "Variable values were written to the variables schema with "
-                "SQLITE_OK status.");
+            symbol->setId(existingId->second);
         }
         else
         {
-            if (sqlite3_extended_errcode(database) == SQLITE_CONSTRAINT_UNIQUE)
-            {
-                logger.logDebug("%s.", errorMessage);
-                rc = SQLITE_OK;
-            }
-            else
-            {
-                logger.logDebug("There was an error while writing data to the variables table.");
-                logger.logDebug("%s.", errorMessage);
-                rc = SQLITEDB_ERROR;
-            }
+            symbol->setId(nextSymbolId++);
+            symbolIds[symbol->getInternedName()] = symbol->getId();
+            newSymbols.push_back(symbol);
         }
     }
 
-    return rc;
-}
-
-/**
- *@brief Iterates through all of the ELF entries in
- *inElf and writes each one to the "elfs" table.
- *
- *@param inElf The elf that has the Elf data.
- *
- *@return Returns SQLITEDB_OK if all of the elf entries are written to the
- *database successfully. If the method fails to write at least one of the
- *elf entries to the database, then SQLITEDB_ERROR is returned.
- */
-int SQLiteDB::writeElfSectionsToDatabase(ElfFile& inElf)
-{
-    int   rc           = SQLITEDB_OK;
-    char* errorMessage = NULL;
-
-    switch (inElf.getElfClass())
+    for (auto&& symbol : newSymbols)
     {
-        case ELFCLASS32:
-        {
-            for (auto elf32Section : inElf.getElf32Headers())
-            {
-                inElf.getInitializedSymbolData();
-
-                /*
-                 * @todo I want to store these SQLite magical values into MACROS,
-                 * but I'm not sure what is the best way to do that without it being
-                 * messy.
-                 */
-                std::string writeElfSectionsQuery{};
-
-                /**
-                 *@todo Not sure if I should make a seperation in the db between 32-bit and 64-bit sections...
-                 */
-                writeElfSectionsQuery +=
-                    "INSERT INTO elf_sections"
-                    "(name, elf, type, flags, address, file_offset, size, link, info, address_alignment, entry_size ) "
-                    "VALUES(";
-                writeElfSectionsQuery += std::to_string(elf32Section.sh_name);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(inElf.getId());
-
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Section.sh_type);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Section.sh_flags);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Section.sh_addr);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Section.sh_offset);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Section.sh_size);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Section.sh_link);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Section.sh_info);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Section.sh_addralign);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Section.sh_entsize);
-
-                writeElfSectionsQuery += ");";
-
-                logger.logDebug("Sending \"%s\" query to database.", writeElfSectionsQuery.c_str());
-
-                rc = sqlite3_exec(database, writeElfSectionsQuery.c_str(), NULL, NULL, &errorMessage);
-
-                if (SQLITE_OK == rc)
-                {
-                    logger.logDebug(
-                        "Variable values were written to the variables schema with "
-                        "SQLITE_OK status.");
-                }
-                else
-                {
-                    if (sqlite3_extended_errcode(database) == SQLITE_CONSTRAINT_UNIQUE)
-                    {
-                        logger.logDebug("%s.", errorMessage);
-                        rc = SQLITE_OK;
-                    }
-                    else
-                    {
-                        logger.logDebug("There was an error while writing data to the variables table.");
-                        logger.logDebug("%s.", errorMessage);
-                        rc = SQLITEDB_ERROR;
-                    }
-                }
-            }
+        SymbolRow row{symbol->getId(), symbol->getInternedName(), symbol->getByteSize(), 0, symbol->getArtifact().getId(), 0, symbol->getLongDescription(),
+                      symbol->getShortDescription()};
 
-            break;
-        }
-        case ELFCLASS64:
+        if (symbol->hasEncoding())
         {
-            for (auto elf64Section : inElf.getElf64Headers())
-            {
-                inElf.getInitializedSymbolData();
-
-                /*
-                 * @todo I want to store these SQLite magical values into MACROS,
-                 * but I'm not sure what is the best way to do that without it being
-                 * messy.
-                 */
-                std::string writeElfSectionsQuery{};
-
-                /**
-                 *@todo Not sure if I should make a seperation in the db between 32-bit and 64-bit sections...
-                 */
-                writeElfSectionsQuery +=
-                    "INSERT INTO elf_sections"
-                    "(name, elf, type, flags, address, file_offset, size, link, info, address_alignment, entry_size ) "
-                    "VALUES(";
-                writeElfSectionsQuery += std::to_string(elf64Section.sh_name);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(inElf.getId());
-
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Section.sh_type);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Section.sh_flags);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Section.sh_addr);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Section.sh_offset);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Section.sh_size);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Section.sh_link);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Section.sh_info);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Section.sh_addralign);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Section.sh_entsize);
-
-                writeElfSectionsQuery += ");";
-
-                logger.logDebug("Sending \"%s\" query to database.", writeElfSectionsQuery.c_str());
-
-                rc = sqlite3_exec(database, writeElfSectionsQuery.c_str(), NULL, NULL, &errorMessage);
+            row.encodingId = inElf.getDWARFEncoding(symbol->getEncoding()).getId();
+        }
 
-                if (SQLITE_OK == rc)
-                {
-                    logger.logDebug(
-                        "Variable values were written to the variables schema with "
-                        "SQLITE_OK status.");
-                }
-                else
-                {
-                    if (sqlite3_extended_errcode(database) == SQLITE_CONSTRAINT_UNIQUE)
-                    {
-                        logger.logDebug("%s.", errorMessage);
-                        rc = SQLITE_OK;
-                    }
-                    else
-                    {
-                        logger.logDebug("There was an error while writing data to the variables table.");
-                        logger.logDebug("%s.", errorMessage);
-                        rc = SQLITEDB_ERROR;
-                    }
-                }
-            }
+        batchedEncodingIds[symbol->getId()] = row.encodingId;
 
-            break;
+        if (symbol->hasTargetSymbol())
+        {
+            row.targetSymbolId               = symbol->getTargetSymbol()->getId();
+            targetSymbolIds[symbol->getId()] = row.targetSymbolId;
         }
+
+        batch.symbols.push_back(std::move(row));
     }
 
-    return rc;
+    for (size_t i = first; i < symbols.size(); i++)
+    {
+        addMembersToBatch(*symbols[i], batch);
+    }
 }
 
 /**
- *@brief Iterates through all of the ELF entries in
- *inElf and writes each one to the "elfs" table.
- *
- *@param inElf The elf that has the Elf data.
+ *@brief Adds the rows of the fields, with their dimensions, and of the enumerations of symbol to batch.
  *
- *@return Returns SQLITEDB_OK if all of the elf entries are written to the
- *database successfully. If the method fails to write at least one of the
- *elf entries to the database, then SQLITEDB_ERROR is returned.
+ *Between beginElf and endElf, members that were batched before are skipped. A struct that a later
+ *CU reads again gets the members it did not have yet added to it, and endElf batches only those.
  */
-int SQLiteDB::writeElfSymboltableSymbolsToDatabase(ElfFile& inElf)
+void SQLiteDB::addMembersToBatch(Symbol& symbol, SymbolBatch& batch)
 {
-    int   rc           = SQLITEDB_OK;
-    char* errorMessage = NULL;
-
-    switch (inElf.getElfClass())
+    for (auto field : symbol.getFields())
     {
-        case ELFCLASS32:
+        if (pipeline && !batchedFields.insert(field).second)
         {
-            for (auto elf32Symbol : inElf.getElf32SymbolTable())
-            {
-                inElf.getInitializedSymbolData();
-
-                /*
-                 * @todo I want to store these SQLite magical values into MACROS,
-                 * but I'm not sure what is the best way to do that without it being
-                 * messy.
-                 */
-                std::string writeElfSectionsQuery{};
-
-                /**
-                 *@todo Not sure if I should make a seperation in the db between 32-bit and 64-bit sections...
-                 */
-                writeElfSectionsQuery +=
-                    "INSERT INTO elf_symbol_table"
-                    "(name, elf, value, size, info, other, section_index, file_offset, string_table_file_offset ) "
-                    "VALUES(";
-                //        writeElfSectionsQuery += "\"";
-                writeElfSectionsQuery += std::to_string(elf32Symbol.getSymbol().st_name);
-                //        writeElfSectionsQuery += "\"";
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(inElf.getId());
-
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Symbol.getSymbol().st_value);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Symbol.getSymbol().st_size);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Symbol.getSymbol().st_info);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Symbol.getSymbol().st_other);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Symbol.getSymbol().st_shndx);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Symbol.getFileOffset());
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf32Symbol.getStrTableFileOffset());
-                writeElfSectionsQuery += ");";
-
-                logger.logDebug("Sending \"%s\" query to database.", writeElfSectionsQuery.c_str());
-
-                rc = sqlite3_exec(database, writeElfSectionsQuery.c_str(), NULL, NULL, &errorMessage);
-
-                if (SQLITE_OK == rc)
-                {
-                    logger.logDebug(
-                        "Variable values were written to the variables schema with "
-                        "SQLITE_OK status.");
-                }
-                else
-                {
-                    if (sqlite3_extended_errcode(database) == SQLITE_CONSTRAINT_UNIQUE)
-                    {
-                        logger.logDebug("%s.", errorMessage);
-                        rc = SQLITE_OK;
-                    }
-                    else
-                    {
-                        logger.logDebug("There was an error while writing data to the variables table.");
-                        logger.logDebug("%s.", errorMessage);
-                        rc = SQLITEDB_ERROR;
-                    }
-                }
-            }
-            break;
+            continue;
         }
-        case ELFCLASS64:
+
+        FieldRow row{0,
+                     symbol.getId(),
+                     field->getInternedName(),
+                     field->getByteOffset(),
+                     field->getType().getId(),
+                     field->isLittleEndian(),
+                     field->getBitSize(),
+                     field->getBitOffset(),
+                     field->getLongDescription(),
+                     field->getShortDescription(),
+                     {}};
+
+        if (field->isArray())
         {
-            for (auto elf64Symbol : inElf.getElf64SymbolTable())
+            for (auto&& dim : field->getDimensionList().getDimensions())
             {
-                inElf.getInitializedSymbolData();
-
-                /*
-                 * @todo I want to store these SQLite magical values into MACROS,
-                 * but I'm not sure what is the best way to do that without it being
-                 * messy.
-                 */
-                std::string writeElfSectionsQuery{};
-
-                /**
-                 *@todo Not sure if I should make a seperation in the db between 32-bit and 64-bit sections...
-                 */
-                writeElfSectionsQuery +=
-                    "INSERT INTO elf_symbol_table"
-                    "(name, elf, value, size, info, other, section_index, file_offset, string_table_file_offset ) "
-                    "VALUES(";
-                //        writeElfSectionsQuery += "\"";
-                writeElfSectionsQuery += std::to_string(elf64Symbol.getSymbol().st_name);
-                //        writeElfSectionsQuery += "\"";
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(inElf.getId());
-
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Symbol.getSymbol().st_value);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Symbol.getSymbol().st_size);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Symbol.getSymbol().st_info);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Symbol.getSymbol().st_other);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Symbol.getSymbol().st_shndx);
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Symbol.getFileOffset());
-                writeElfSectionsQuery += ",";
-                writeElfSectionsQuery += std::to_string(elf64Symbol.getStrTableFileOffset());
-                writeElfSectionsQuery += ");";
-
-                logger.logDebug("Sending \"%s\" query to database.", writeElfSectionsQuery.c_str());
-
-                rc = sqlite3_exec(database, writeElfSectionsQuery.c_str(), NULL, NULL, &errorMessage);
-
-                if (SQLITE_OK == rc)
-                {
-                    logger.logDebug(
-                        "Variable values were written to the variables schema with "
-                        "SQLITE_OK status.");
-                }
-                else
-                {
-                    if (sqlite3_extended_errcode(database) == SQLITE_CONSTRAINT_UNIQUE)
-                    {
-                        logger.logDebug("%s.", errorMessage);
-                        rc = SQLITE_OK;
-                    }
-                    else
-                    {
-                        logger.logDebug("There was an error while writing data to the variables table.");
-                        logger.logDebug("%s.", errorMessage);
-                        rc = SQLITEDB_ERROR;
-                    }
-                }
+                row.upperBounds.push_back(dim.getUpperBound());
             }
-            break;
         }
+
+        batch.fields.push_back(std::move(row));
     }
 
-    return rc;
+    for (auto enumeration : symbol.getEnumerations())
+    {
+        if (pipeline && !batchedEnumerations.insert(enumeration).second)
+        {
+            continue;
+        }
+
+        batch.enumerations.push_back(
+            EnumerationRow{symbol.getId(), enumeration->getValue(), enumeration->getName(), enumeration->getLongDescription(), enumeration->getShortDescription()});
+    }
 }
 
 /**
- *@brief Iterates through all of the Artifact entries in
- *inElf and writes each one to the "artifacts" table.
+ *@brief Writes the rows addSymbolsToBatch collected to the "artifacts", "symbols", "fields",
+ *"dimension_lists" and "enumerations" tables, in that order.
  *
- *@param inElf The elf that has the Elf data.
+ *Only touches the database and the rows themselves, so it can run on the writer thread.
  *
- *@return Returns SQLITEDB_OK if all of the artifact entries are written to the
- *database successfully. If the method fails to write at least one of the
- *elf entries to the database, then SQLITEDB_ERROR is returned.
+ *@return Returns SQLITEDB_OK if all of the rows were written, or already were in the
+ *database. Otherwise, SQLITEDB_ERROR.
  */
-int SQLiteDB::writeArtifactsToDatabase(ElfFile& inElf)
+int SQLiteDB::writeBatch(SymbolBatch& batch)
 {
-    int   rc           = SQLITEDB_OK;
-    char* errorMessage = NULL;
+    int rc = SQLITEDB_OK;
 
-    /*
-     * @todo I want to store these SQLite magical values into MACROS,
-     * but I'm not sure what is the best way to do that without it being
-     * messy.
-     */
-    for (auto&& s : inElf.getSymbols())
     {
-        Artifact& ar            = s->getArtifact();
+        Stats::Timer timer{STATS_PHASE_DB_ARTIFACTS};
 
-        bool      artifacExists = doesArtifactExist(ar.getFilePath());
+        rc = writeArtifactRows(batch.artifacts);
+        logWriteStatus(rc, "artifacts");
+    }
 
-        /**
-         *First check if the symbol already exists in the database.
-         *If it does we don't need to write to the database. In that case, all we need is
-         *to get the id which will be used by other tables such as enumerations and fields as
-         * a foreign key.
-         */
-        if (artifacExists)
-        {
-            std::map<std::string, std::vector<std::string>> artifactMap{};
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::Timer timer{STATS_PHASE_DB_SYMBOLS};
 
-            std::string                                     getArtifactIdQuery{"SELECT * FROM artifacts where path="};
-            getArtifactIdQuery += "\"";
-            getArtifactIdQuery += ar.getFilePath();
+        rc = writeSymbolRows(batch.symbols);
+        logWriteStatus(rc, "symbols");
+    }
 
-            getArtifactIdQuery += "\";";
-            rc                  = sqlite3_exec(database, getArtifactIdQuery.c_str(), SQLiteDB::selectCallback, &artifactMap, &errorMessage);
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::Timer timer{STATS_PHASE_DB_FIELDS};
 
-            if (SQLITE_OK == rc)
-            {
-                /**
-                 * We know there is only one element in our map, since paths are unique.
-                 */
-                for (auto pair : artifactMap)
-                {
-                    ar.setId(std::stoul(pair.first));
-                }
+        rc = writeFieldRows(batch.fields);
+        logWriteStatus(rc, "fields");
+    }
 
-                std::istringstream md5Hex{artifactMap.at(std::to_string(ar.getId())).at(2)};
-                ar.setMD5(md5Hex.str());
-            }
-        }
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::Timer timer{STATS_PHASE_DB_DIMENSION_LISTS};
 
-        else
-        {
-            std::string writArtifactQuery{};
+        rc = writeDimensionRows(batch.fields);
+        logWriteStatus(rc, "dimension_lists");
+    }
 
-            std::string md5 = ar.getMD5();
+    if (SQLITEDB_OK == rc)
+    {
+        Stats::Timer timer{STATS_PHASE_DB_ENUMERATIONS};
 
-            writArtifactQuery +=
-                "INSERT INTO artifacts(elf, path, md5) "
-                "VALUES(";
-            writArtifactQuery += std::to_string(inElf.getId());
-            writArtifactQuery += ",";
-            writArtifactQuery += "\"";
-            writArtifactQuery += ar.getFilePath();
-            writArtifactQuery += "\"";
-            writArtifactQuery += ",\"";
-            writArtifactQuery += md5;
-            writArtifactQuery += "\"";
-            writArtifactQuery += ");";
+        rc = writeEnumerationRows(batch.enumerations);
+        logWriteStatus(rc, "enumerations");
+    }
 
-            logger.logDebug("Sending \"%s\" query to database.", writArtifactQuery.c_str());
+    return rc;
+}
 
-            rc = sqlite3_exec(database, writArtifactQuery.c_str(), NULL, NULL, &errorMessage);
-            if (SQLITE_OK == rc)
-            {
-                logger.logDebug(
-                    "Elf values were written to the artifacts schema with "
-                    "SQLITE_OK status.");
-                /*Write the id to this elf so that other tables can use it as
-                 *a foreign key */
-
-                sqlite3_int64 lastRowId = sqlite3_last_insert_rowid(database);
-                ar.setId(lastRowId);
-            }
-            else
-            {
-                if (sqlite3_extended_errcode(database) == SQLITE_CONSTRAINT_UNIQUE)
-                {
-                    logger.logDebug("%s.", errorMessage);
-                    rc = SQLITE_OK;
-                }
-                else
-                {
-                    logger.logDebug("There was an error while writing data to the artifacts table.");
-                    logger.logDebug("%s.", errorMessage);
-                    rc = SQLITEDB_ERROR;
-                }
-            }
+/**
+ *@brief Writes each of rows to the "artifacts" table.
+ *
+ *@return Returns SQLITEDB_OK if all of the artifact entries are written to the
+ *database successfully. If the method fails to write at least one of the
+ *artifact entries to the database, then SQLITEDB_ERROR is returned.
+ */
+int SQLiteDB::writeArtifactRows(std::vector<ArtifactRow>& rows)
+{
+    int rc = SQLITEDB_OK;
+
+    for (auto&& row : rows)
+    {
+        sqlite3_bind_int64(insertArtifactStmt, 1, row.id);
+        sqlite3_bind_int64(insertArtifactStmt, 2, currentElfId);
+        sqlite3_bind_text(insertArtifactStmt, 3, row.path.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_text(insertArtifactStmt, 4, row.md5.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_text(insertArtifactStmt, 5, currentChecksumAlgorithm.c_str(), -1, SQLITE_STATIC);
+
+        rc = stepStatement(insertArtifactStmt, "artifacts");
 
-            writArtifactQuery.clear();
+        if (SQLITE_DONE != rc)
+        {
+            /* The artifact was not in artifactIds, so a conflict here means something is off. */
+            logger.logError("Failed to write artifact \"%s\".", row.path.c_str());
+            rc = SQLITEDB_ERROR;
+            break;
         }
     }
 
-    return rc;
+    return SQLITEDB_ERROR == rc ? SQLITEDB_ERROR : SQLITEDB_OK;
 }
 
 /**
- *@brief Iterates through all of the symbols entries in
- *inElf and writes each one to the "symbols" table.
- *
+ *@brief Writes each of rows to the "symbols" table. Every one of them is new, and is
+ *written with the id and target_symbol addSymbolsToBatch gave it.
  *
  *@return Returns SQLITEDB_OK if all of the symbols entries are written to the
  *database successfully. If the method fails to write at least one of the
  *symbol entries to the database, then SQLITEDB_ERROR is returned.
  */
-int SQLiteDB::writeSymbolsToDatabase(ElfFile& inElf)
+int SQLiteDB::writeSymbolRows(std::vector<SymbolRow>& rows)
 {
-    int   rc           = SQLITEDB_OK;
-    char* errorMessage = nullptr;
-
-    /**
-     * @note Are we allowed for ground tools to do this for loops?
-     * I know for Flight Software we need to explicitly state the "++i",
-     * but should/can we do this here with loops for Juicer?
-     */
+    int rc = SQLITEDB_OK;
 
-    for (auto&& symbol : inElf.getSymbols())
+    for (auto&& row : rows)
     {
-        bool symbolExists = doesSymbolExist(symbol->getName());
+        sqlite3_bind_int64(insertSymbolStmt, 1, row.id);
+        sqlite3_bind_int64(insertSymbolStmt, 2, currentElfId);
+        sqlite3_bind_text(insertSymbolStmt, 3, row.name.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int64(insertSymbolStmt, 4, row.byteSize);
 
-        /**
-         *First check if the symbol already exists in the database.
-         *If it does we don't need to write to the database. In that case, all we need is
-         *to get the id which will be used by other tables such as enumerations and fields as
-         * a foreign key.
-         */
-        if (symbolExists)
+        if (row.encodingId != 0)
         {
-            std::map<std::string, std::vector<std::string>> symbolsMap{};
-
-            std::string                                     getSymbolIdQuery{"SELECT * FROM symbols where name="};
-            getSymbolIdQuery += "\"";
-            getSymbolIdQuery += symbol->getName();
-
-            getSymbolIdQuery += "\";";
-            rc                = sqlite3_exec(database, getSymbolIdQuery.c_str(), SQLiteDB::selectCallback, &symbolsMap, &errorMessage);
-
-            if (SQLITE_OK == rc)
-            {
-                /**
-                 * We know there is only one element in our map, since symbol names are unique.
-                 */
-                for (auto pair : symbolsMap)
-                {
-                    symbol->setId(std::stoi(pair.first));
-                }
-            }
+            sqlite3_bind_int64(insertSymbolStmt, 5, row.encodingId);
         }
-
         else
         {
-            /*
-             * @todo I want to store these SQLite magical values into MACROS,
-             * but I'm not sure what is the best way to do that without it being
-             * messy.
-             */
-            std::string writeSymbolQuery{};
-
-            if (!symbol->hasEncoding())
-            {
-                writeSymbolQuery +=
-                    "INSERT INTO symbols(elf, name, byte_size, artifact, long_description, short_description) "
-                    "VALUES(";
-                writeSymbolQuery += std::to_string(symbol->getElf().getId());
-                writeSymbolQuery += ",\"";
-                writeSymbolQuery += symbol->getName();
-
-                writeSymbolQuery += "\",";
-                writeSymbolQuery += std::to_string(symbol->getByteSize());
-                writeSymbolQuery += ",";
-                writeSymbolQuery += std::to_string(symbol->getArtifact().getId());
-
-                writeSymbolQuery += ",\"";
-                writeSymbolQuery += symbol->getLongDescription();
-
-                writeSymbolQuery += "\",";
-
-                writeSymbolQuery += "\"";
-                writeSymbolQuery += symbol->getShortDescription();
-
-                writeSymbolQuery += "\"";
-
-                writeSymbolQuery += ")";
+            sqlite3_bind_null(insertSymbolStmt, 5);
+        }
 
-                rc                = sqlite3_exec(database, writeSymbolQuery.c_str(), NULL, NULL, &errorMessage);
+        sqlite3_bind_int64(insertSymbolStmt, 6, row.artifactId);
+        sqlite3_bind_text(insertSymbolStmt, 7, row.longDescription.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_text(insertSymbolStmt, 8, row.shortDescription.c_str(), -1, SQLITE_STATIC);
 
-                if (SQLITE_OK == rc)
-                {
-                    logger.logDebug(
-                        "Symbol values were written to the symbols schema with "
-                        "SQLITE_OK status.");
+        if (row.targetSymbolId != 0)
+        {
+            sqlite3_bind_int64(insertSymbolStmt, 9, row.targetSymbolId);
+        }
+        else
+        {
+            sqlite3_bind_null(insertSymbolStmt, 9);
+        }
 
-                    /*Write the id to this symbol so that other tables can use it as
-                     *a foreign key */
-                    sqlite3_int64 lastRowId = sqlite3_last_insert_rowid(database);
+        rc = stepStatement(insertSymbolStmt, "symbols");
 
-                    symbol->setId(lastRowId);
-                }
-                else
-                {
-                    logger.logError(
-                        "Looks like something went wrong with query "
-                        "\"%s\":\"%s\"",
-                        writeSymbolQuery, errorMessage);
-                }
-            }
+        if (SQLITE_DONE != rc)
+        {
+            /* The symbol was not in symbolIds, so a conflict here means something is off. */
+            logger.logError("Failed to write symbol \"%s\".", row.name.c_str());
+            rc = SQLITEDB_ERROR;
+            break;
+        }
+    }
 
-            else
-            {
-                writeSymbolQuery +=
-                    "INSERT INTO symbols(elf, name, byte_size, encoding, artifact, long_description, short_description) "
-                    "VALUES(";
-                writeSymbolQuery += std::to_string(symbol->getElf().getId());
-                writeSymbolQuery += ",\"";
-                writeSymbolQuery += symbol->getName();
+    return SQLITEDB_ERROR == rc ? SQLITEDB_ERROR : SQLITEDB_OK;
+}
 
-                writeSymbolQuery += "\",";
-                writeSymbolQuery += std::to_string(symbol->getByteSize());
-                writeSymbolQuery += ",";
+/**
+ *@brief Sets target_symbol of every symbol of inElf that was already in the database,
+ *or was written before its target was known, and whose target_symbol changed.
+ *
+ *@return Returns SQLITEDB_OK if all of the symbols were updated. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::writeTargetSymbolsToDatabase(ElfFile& inElf)
+{
+    sqlite3_stmt* stmt = NULL;
+    int           rc   = prepareStatement("UPDATE symbols SET target_symbol = ? WHERE id = ?;", &stmt);
 
-                writeSymbolQuery += "\"";
-                writeSymbolQuery += std::to_string(symbol->getElf().getDWARFEncoding(symbol->getEncoding()).getId());
-                // writeSymbolQuery += "-47";
-                writeSymbolQuery += "\",";
+    if (SQLITEDB_OK != rc)
+    {
+        return rc;
+    }
 
-                writeSymbolQuery += std::to_string(symbol->getArtifact().getId());
+    for (auto&& symbol : inElf.getSymbols())
+    {
+        if (symbol->hasTargetSymbol())
+        {
+            auto targetId = targetSymbolIds.find(symbol->getId());
 
-                writeSymbolQuery += ",\"";
-                writeSymbolQuery += symbol->getLongDescription();
+            if (targetId != targetSymbolIds.end() && targetId->second == symbol->getTargetSymbol()->getId())
+            {
+                continue;
+            }
 
-                writeSymbolQuery += "\",";
+            sqlite3_bind_int64(stmt, 1, symbol->getTargetSymbol()->getId());
+            sqlite3_bind_int64(stmt, 2, symbol->getId());
 
-                writeSymbolQuery += "\"";
-                writeSymbolQuery += symbol->getShortDescription();
+            rc = stepStatement(stmt, "symbols");
 
-                writeSymbolQuery += "\"";
+            if (SQLITEDB_ERROR == rc)
+            {
+                break;
+            }
 
-                writeSymbolQuery += ")";
+            targetSymbolIds[symbol->getId()] = symbol->getTargetSymbol()->getId();
+        }
+    }
 
-                rc                = sqlite3_exec(database, writeSymbolQuery.c_str(), NULL, NULL, &errorMessage);
+    sqlite3_finalize(stmt);
 
-                if (SQLITE_OK == rc)
-                {
-                    logger.logDebug(
-                        "Symbol values were written to the symbols schema with "
-                        "SQLITE_OK status.");
+    return SQLITEDB_ERROR == rc ? SQLITEDB_ERROR : SQLITEDB_OK;
+}
 
-                    /*Write the id to this symbol so that other tables can use it as
-                     *a foreign key */
-                    sqlite3_int64 lastRowId = sqlite3_last_insert_rowid(database);
+/**
+ *@brief Sets the encoding of every symbol inElf added to the database whose encoding
+ *Juicer set or changed after the symbol was batched. That happens when a later compilation
+ *unit of an elf that is written while it is read gives a base type its encoding again.
+ *
+ *@return Returns SQLITEDB_OK if all of the symbols were updated. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::writeSymbolEncodingsToDatabase(ElfFile& inElf)
+{
+    sqlite3_stmt* stmt = NULL;
+    int           rc   = prepareStatement("UPDATE symbols SET encoding = ? WHERE id = ?;", &stmt);
 
-                    symbol->setId(lastRowId);
-                }
-                else
-                {
-                    logger.logError(
-                        "Looks like something went wrong with query "
-                        "\"%s\":\"%s\"",
-                        writeSymbolQuery, errorMessage);
-                }
-            }
-        }
+    if (SQLITEDB_OK != rc)
+    {
+        return rc;
     }
 
-    // Add symbol to target_symbol mappings to database
     for (auto&& symbol : inElf.getSymbols())
     {
-        if (symbol->hasTargetSymbol())
+        auto batchedId = batchedEncodingIds.find(symbol->getId());
+
+        if (batchedId == batchedEncodingIds.end() || !symbol->hasEncoding())
         {
-            /*
-             * @todo I want to store these SQLite magical values into MACROS,
-             * but I'm not sure what is the best way to do that without it being
-             * messy.
-             */
-            std::string writeSymbolQuery{};
-            writeSymbolQuery += "UPDATE symbols SET target_symbol = ";
+            continue;
+        }
 
-            writeSymbolQuery += "\"";
-            writeSymbolQuery += std::to_string(symbol->getTargetSymbol()->getId());
-            writeSymbolQuery += "\"";
+        sqlite3_int64 encodingId = inElf.getDWARFEncoding(symbol->getEncoding()).getId();
 
-            writeSymbolQuery += " WHERE id = ";
+        if (batchedId->second == encodingId)
+        {
+            continue;
+        }
 
-            writeSymbolQuery += "\"";
-            writeSymbolQuery += std::to_string(symbol->getId());
-            writeSymbolQuery += "\"";
+        sqlite3_bind_int64(stmt, 1, encodingId);
+        sqlite3_bind_int64(stmt, 2, symbol->getId());
 
-            rc                = sqlite3_exec(database, writeSymbolQuery.c_str(), NULL, NULL, &errorMessage);
+        rc = stepStatement(stmt, "symbols");
 
-            if (SQLITE_OK == rc)
-            {
-                logger.logDebug(
-                    "Symbol values were written to the symbols schema with "
-                    "SQLITE_OK status.");
-            }
-            else
-            {
-                logger.logError(
-                    "Looks like something went wrong with query "
-                    "\"%s\":\"%s\"",
-                    writeSymbolQuery, errorMessage);
-            }
+        if (SQLITEDB_ERROR == rc)
+        {
+            break;
         }
+
+        batchedId->second = encodingId;
     }
 
-    return rc;
+    sqlite3_finalize(stmt);
+
+    return SQLITEDB_ERROR == rc ? SQLITEDB_ERROR : SQLITEDB_OK;
 }
 
 /**
- *@brief Iterates through all of the field entries in
- *inElf and writes each one to the "fields" table.
+ *@brief Writes each of rows to the "fields" table, and sets the id of each row that was
+ *written. A row that was skipped because the field already is in the database keeps id 0.
  *
- *@return Returns SQLITEDB_OK if all of the elf entries are written to the
+ *@return Returns SQLITEDB_OK if all of the field entries are written to the
  *database successfully. If the method fails to write at least one of the
  *field entries to the database, then SQLITEDB_ERROR is returned.
  */
-int SQLiteDB::writeFieldsToDatabase(ElfFile& inElf)
+int SQLiteDB::writeFieldRows(std::vector<FieldRow>& rows)
 {
-    int   rc           = SQLITEDB_OK;
-    char* errorMessage = NULL;
+    int rc = SQLITEDB_OK;
 
-    /**
-     * @note Are we allowed for ground tools to do this for loops?
-     * I know for Flight Software we need to explicitly state the "++i",
-     * but should/can we do this here with loops for Juicer?
-     */
-    for (auto field : inElf.getFields())
+    for (auto&& row : rows)
     {
-        /*
-         * @todo I want to store these SQLite magical values into MACROS,
-         * but I'm not sure what is the best way to do that without it being
-         * messy.
-         */
-        std::string writeFieldQuery{};
-
-        writeFieldQuery +=
-            "INSERT INTO fields(symbol, name, byte_offset, type, "
-            "little_endian, bit_size, bit_offset, long_description, short_description) VALUES(";
-        writeFieldQuery += std::to_string(field->getSymbol().getId());
-        writeFieldQuery += ",";
-        writeFieldQuery += "\"";
-        writeFieldQuery += field->getName();
-        writeFieldQuery += "\"";
-        writeFieldQuery += ",";
-        writeFieldQuery += std::to_string(field->getByteOffset());
-        writeFieldQuery += ",";
-        writeFieldQuery += std::to_string(field->getType().getId());
-        writeFieldQuery += ",";
-        writeFieldQuery += std::to_string(field->isLittleEndian() ? SQLiteDB_TRUE : SQLiteDB_FALSE);
-
-        writeFieldQuery += ",";
-        writeFieldQuery += std::to_string(field->getBitSize());
-        writeFieldQuery += ",";
-        writeFieldQuery += std::to_string(field->getBitOffset());
-
-        writeFieldQuery += ",";
-        writeFieldQuery += "\"";
-        writeFieldQuery += field->getLongDescription();
-        writeFieldQuery += "\"";
-
-        writeFieldQuery += ",";
-        writeFieldQuery += "\"";
-        writeFieldQuery += field->getShortDescription();
-        writeFieldQuery += "\"";
-
-        writeFieldQuery += ");";
-
-        rc               = sqlite3_exec(database, writeFieldQuery.c_str(), NULL, NULL, &errorMessage);
+        if (bulkLoad && !writtenFieldNames[row.symbolId].insert(row.name).second)
+        {
+            rc = SQLITE_CONSTRAINT;
+        }
+        else
+        {
+            sqlite3_bind_int64(insertFieldStmt, 1, nextFieldId);
+            sqlite3_bind_int64(insertFieldStmt, 2, row.symbolId);
+            sqlite3_bind_text(insertFieldStmt, 3, row.name.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_int64(insertFieldStmt, 4, row.byteOffset);
+            sqlite3_bind_int64(insertFieldStmt, 5, row.typeId);
+            sqlite3_bind_int(insertFieldStmt, 6, row.littleEndian ? SQLiteDB_TRUE : SQLiteDB_FALSE);
+            sqlite3_bind_int64(insertFieldStmt, 7, row.bitSize);
+            sqlite3_bind_int64(insertFieldStmt, 8, row.bitOffset);
+            sqlite3_bind_text(insertFieldStmt, 9, row.longDescription.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_text(insertFieldStmt, 10, row.shortDescription.c_str(), -1, SQLITE_STATIC);
+
+            rc = stepInsert(insertFieldStmt, "fields");
+        }
 
-        if (SQLITE_OK == rc)
+        if (SQLITE_DONE == rc)
         {
-            /*Write the id to this field so that other tables can use it as
-             *a foreign key */
-            sqlite3_int64 lastRowId = sqlite3_last_insert_rowid(database);
-            field->setId(lastRowId);
+            /* A field that was skipped leaves its id unused. */
+            row.id = nextFieldId++;
+        }
+        else if (SQLITE_CONSTRAINT == rc)
+        {
+            logger.logWarning("SQLITE_CONSTRAINT_UNIQUE violated for field \"%s\".", row.name.c_str());
         }
         else
         {
-            if (sqlite3_extended_errcode(database) == SQLITE_CONSTRAINT_UNIQUE)
-            {
-                rc = SQLITE_OK;
-                logger.logWarning(
-                    "SQLITE_CONSTRAINT_UNIQUE violated. "
-                    "Query:\"%s\""
-                    "Error message:%s.",
-                    writeFieldQuery.c_str(), errorMessage);
-            }
-            else
-            {
-                rc = SQLITEDB_ERROR;
-                logger.logError(
-                    "There was an error while writing data to the fields table. "
-                    "Query:\"%s\""
-                    "Error message:%s.",
-                    writeFieldQuery.c_str(), errorMessage);
-            }
+            break;
         }
     }
 
-    return rc;
+    return SQLITEDB_ERROR == rc ? SQLITEDB_ERROR : SQLITEDB_OK;
 }
 
 /**
- *@brief Iterates through all of the field entries in
- *inElf and writes each one to the "fields" table.
+ *@brief Writes the dimensions of each of rows that writeFieldRows wrote to the "dimension_lists" table.
  *
- *@return Returns SQLITEDB_OK if all of the elf entries are written to the
+ *@return Returns SQLITEDB_OK if all of the dimension entries are written to the
  *database successfully. If the method fails to write at least one of the
- *field entries to the database, then SQLITEDB_ERROR is returned.
+ *dimension entries to the database, then SQLITEDB_ERROR is returned.
  */
-int SQLiteDB::writeDimensionsListToDatabase(ElfFile& inElf)
+int SQLiteDB::writeDimensionRows(std::vector<FieldRow>& rows)
 {
-    // TODO:Add dimensions to ElfFile object.
-    int   rc           = SQLITEDB_OK;
-    char* errorMessage = NULL;
+    int rc = SQLITEDB_OK;
 
-    /**
-     * @note Are we allowed for ground tools to do this for loops?
-     * I know for Flight Software we need to explicitly state the "++i",
-     * but should/can we do this here with loops for Juicer?
-     */
-    for (auto field : inElf.getFields())
+    for (auto&& row : rows)
     {
-        if (field->isArray())
+        /* A field that was already in the database was not written and has no id. Its dimensions are in the database too. */
+        if (row.id == 0)
         {
-            uint32_t dimOrder = 0;
-            for (auto dim : field->getDimensionList().getDimensions())
-            {
-                /*
-                 * @todo I want to store these SQLite magical values into MACROS,
-                 * but I'm not sure what is the best way to do that without it being
-                 * messy.
-                 */
-                std::string writeDimsQuery{};
-
-                writeDimsQuery +=
-                    "INSERT INTO dimension_lists(field_id, dim_order, upper_bound"
-                    ") VALUES(";
-                writeDimsQuery += std::to_string(field->getId());
-                writeDimsQuery += ",";
-                writeDimsQuery += std::to_string(dimOrder);
-                writeDimsQuery += ",";
-                writeDimsQuery += std::to_string(dim.getUpperBound());
-
-                writeDimsQuery += ");";
-
-                rc              = sqlite3_exec(database, writeDimsQuery.c_str(), NULL, NULL, &errorMessage);
+            continue;
+        }
 
-                if (SQLITE_OK == rc)
-                {
-                    logger.logDebug(
-                        "DimensionList values were written to the symbols schema with "
-                        "SQLITE_OK status.");
-                }
-                else
-                {
-                    if (sqlite3_extended_errcode(database) == SQLITE_CONSTRAINT_UNIQUE)
-                    {
-                        logger.logWarning(
-                            "SQLITE_CONSTRAINT_UNIQUE violated. "
-                            "Query:\"%s\""
-                            "Error message:%s.",
-                            writeDimsQuery.c_str(), errorMessage);
-                        rc = SQLITE_OK;
-                    }
-                    else
-                    {
-                        logger.logError(
-                            "There was an error while writing data to the dimension table. "
-                            "Query:\"%s\""
-                            "Error message:%s.",
-                            writeDimsQuery.c_str(), errorMessage);
-                        rc = SQLITEDB_ERROR;
-                    }
-                }
-                dimOrder++;
+        for (uint32_t dimOrder = 0; dimOrder < row.upperBounds.size(); dimOrder++)
+        {
+            sqlite3_bind_int64(insertDimensionStmt, 1, row.id);
+            sqlite3_bind_int64(insertDimensionStmt, 2, dimOrder);
+            sqlite3_bind_int64(insertDimensionStmt, 3, row.upperBounds[dimOrder]);
+
+            rc = stepInsert(insertDimensionStmt, "dimension_lists");
+
+            if (SQLITE_CONSTRAINT == rc)
+            {
+                logger.logWarning("SQLITE_CONSTRAINT_UNIQUE violated for dimension %u of field \"%s\".", dimOrder, row.name.c_str());
+            }
+            else if (SQLITEDB_ERROR == rc)
+            {
+                break;
             }
         }
+
+        if (SQLITEDB_ERROR == rc)
+        {
+            break;
+        }
     }
 
-    return rc;
+    return SQLITEDB_ERROR == rc ? SQLITEDB_ERROR : SQLITEDB_OK;
 }
 
 /**
- *@brief Iterates through all of the enumeration entries in
- *inElf and writes each one to the "enumerations" table.
+ *@brief Writes each of rows to the "enumerations" table.
  *
- *@return Returns SQLITEDB_OK if all of the elf entries are written to the
+ *@return Returns SQLITEDB_OK if all of the enumeration entries are written to the
  *database successfully. If the method fails to write at least one of the
  *enumeration entries to the database, then SQLITEDB_ERROR is returned.
  */
-int SQLiteDB::writeEnumerationsToDatabase(ElfFile& inElf)
+int SQLiteDB::writeEnumerationRows(std::vector<EnumerationRow>& rows)
 {
-    int   rc           = SQLITEDB_OK;
-    char* errorMessage = NULL;
+    int rc = SQLITEDB_OK;
 
-    /**
-     * @note Are we allowed for ground tools to do this for loops?
-     * I know for Flight Software we need to explicitly state the "++i",
-     * but should/can we do this here with loops for Juicer?
-     */
-    for (auto enumeration : inElf.getEnumerations())
+    for (auto&& row : rows)
     {
-        /*
-         * @todo I want to store these SQLite magical values into MACROS,
-         * but I'm not sure what is the best way to do that without it being
-         * messy.
-         */
-        std::string writeEnumerationQuery{};
+        if (bulkLoad && !writtenEnumerationNames[row.symbolId].insert(row.name).second)
+        {
+            continue;
+        }
 
-        writeEnumerationQuery +=
-            "INSERT INTO enumerations(symbol, value, name, long_description, short_description)"
-            "VALUES(";
-        writeEnumerationQuery += std::to_string(enumeration->getSymbol().getId());
-        writeEnumerationQuery += ",";
-        writeEnumerationQuery += std::to_string(enumeration->getValue());
-        writeEnumerationQuery += ",\"";
-        writeEnumerationQuery += enumeration->getName();
-        writeEnumerationQuery += "\"";
+        sqlite3_bind_int64(insertEnumerationStmt, 1, row.symbolId);
+        sqlite3_bind_int64(insertEnumerationStmt, 2, row.value);
+        sqlite3_bind_text(insertEnumerationStmt, 3, row.name.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_text(insertEnumerationStmt, 4, row.longDescription.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_text(insertEnumerationStmt, 5, row.shortDescription.c_str(), -1, SQLITE_STATIC);
 
-        writeEnumerationQuery += ",\"";
-        writeEnumerationQuery += enumeration->getLongDescription();
-        writeEnumerationQuery += "\"";
+        rc = stepInsert(insertEnumerationStmt, "enumerations");
 
-        writeEnumerationQuery += ",";
-        writeEnumerationQuery += "\"";
-        writeEnumerationQuery += enumeration->getShortDescription();
-        writeEnumerationQuery += "\"";
+        if (SQLITEDB_ERROR == rc)
+        {
+            break;
+        }
+    }
 
-        writeEnumerationQuery += ");";
+    return SQLITEDB_ERROR == rc ? SQLITEDB_ERROR : SQLITEDB_OK;
+}
 
-        rc                     = sqlite3_exec(database, writeEnumerationQuery.c_str(), NULL, NULL, &errorMessage);
+/**
+ *@brief Starts writing inElf on a thread of its own while Juicer reads it. See IDataContainer::beginElf.
+ *
+ *Everything is written in one transaction, like write() does, so an elf that fails to
+ *be read or written leaves nothing behind.
+ *
+ *@return Returns SQLITEDB_OK if the writer thread was started. Otherwise, SQLITEDB_ERROR,
+ *and the transaction is already rolled back.
+ */
+int SQLiteDB::beginElf(ElfFile& inElf)
+{
+    int rc = startElf(inElf);
 
-        if (SQLITE_OK == rc)
+    if (SQLITEDB_OK == rc)
+    {
+        writerResult = SQLITEDB_OK;
+        pipeline     = std::make_unique<BoundedQueue<SymbolBatch>>(SQLITEDB_PIPELINE_DEPTH);
+        writer       = std::thread(&SQLiteDB::runWriter, this);
+    }
+    else
+    {
+        rc = finishElf(inElf, rc);
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Hands the symbols Juicer added to inElf since the last call to the writer thread.
+ *Waits if the writer is SQLITEDB_PIPELINE_DEPTH batches behind.
+ *
+ *@return Returns SQLITEDB_ERROR if the writer has failed, in which case there is no use in
+ *reading the rest of inElf. Otherwise, SQLITEDB_OK.
+ */
+int SQLiteDB::writeNewSymbols(ElfFile& inElf)
+{
+    int rc = SQLITEDB_ERROR;
+
+    if (pipeline)
+    {
+        rc = SQLITEDB_OK;
+
+        if (batchedSymbols < inElf.getSymbols().size())
         {
-            logger.logDebug(
-                "Enumeration values were written to the enumerations schema with "
-                "SQLITE_OK status.");
+            SymbolBatch batch{};
+
+            addSymbolsToBatch(inElf, batchedSymbols, batch);
+            batchedSymbols = inElf.getSymbols().size();
+
+            if (!pipeline->push(std::move(batch)))
+            {
+                rc = SQLITEDB_ERROR;
+            }
         }
-        else
+    }
+    else
+    {
+        logger.logError("writeNewSymbols was called before beginElf.");
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Hands the last symbols of inElf, and the fields and enumerations that earlier
+ *symbols gained since they were batched, to the writer thread. Then waits for it and
+ *writes and commits the rest of inElf. If complete is false, the transaction is rolled back instead.
+ *
+ *@return Returns SQLITEDB_OK if inElf was committed. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::endElf(ElfFile& inElf, bool complete)
+{
+    int rc = SQLITEDB_ERROR;
+
+    if (pipeline)
+    {
+        rc = complete ? SQLITEDB_OK : SQLITEDB_ERROR;
+
+        if (SQLITEDB_OK == rc)
         {
-            logger.logDebug("There was an error while writing data to the enumerations table. %s.", errorMessage);
+            SymbolBatch batch{};
+            size_t      earlierSymbols = batchedSymbols;
+
+            addSymbolsToBatch(inElf, batchedSymbols, batch);
 
-            if (sqlite3_extended_errcode(database) == SQLITE_CONSTRAINT_UNIQUE)
+            for (size_t i = 0; i < earlierSymbols; i++)
             {
-                rc = SQLITE_OK;
+                addMembersToBatch(*inElf.getSymbols()[i], batch);
             }
-            else
+
+            if (!pipeline->push(std::move(batch)))
             {
                 rc = SQLITEDB_ERROR;
             }
         }
+
+        if (SQLITEDB_OK != stopWriter())
+        {
+            rc = SQLITEDB_ERROR;
+        }
+
+        rc = finishElf(inElf, rc);
+    }
+    else
+    {
+        logger.logError("endElf was called before beginElf.");
     }
 
     return rc;
 }
 
+/**
+ *@brief The body of the writer thread beginElf starts. Writes every batch it is handed
+ *until endElf closes the queue. After a batch fails, it closes the queue itself, which
+ *makes writeNewSymbols fail so Juicer stops reading.
+ */
+void SQLiteDB::runWriter(void)
+{
+    SymbolBatch batch{};
+
+    while (pipeline->pop(batch))
+    {
+        if (SQLITEDB_OK != writeBatch(batch))
+        {
+            writerResult = SQLITEDB_ERROR;
+            pipeline->close();
+            break;
+        }
+    }
+}
+
+/**
+ *@brief Lets the writer thread finish the batches it has and waits for it.
+ *
+ *@return Returns SQLITEDB_OK if it wrote every one of them. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::stopWriter(void)
+{
+    pipeline->close();
+
+    if (writer.joinable())
+    {
+        writer.join();
+    }
+
+    pipeline.reset();
+
+    return writerResult;
+}
+
 int SQLiteDB::writeEncodingsToDatabase(ElfFile& inElf)
 {
     int                   rc             = SQLITEDB_OK;
@@ -1586,59 +2022,24 @@ int SQLiteDB::writeEncodingsToDatabase(ElfFile& inElf)
 
     if (!doEncodingsExist())
     {
-        for (Encoding encoding : dwarfEncodings)
-        {
-            // Create a SQL statement with placeholders
-            sqlite3_stmt* stmt;
-            const char*   sql = "INSERT INTO encodings (encoding) VALUES (?);";
+        sqlite3_stmt* stmt = NULL;
 
-            // Prepare the SQL statement
-            rc                = sqlite3_prepare_v2(database, sql, -1, &stmt, NULL);
+        rc                 = prepareStatement("INSERT INTO encodings (encoding) VALUES (?);", &stmt);
 
-            if (rc != SQLITE_OK)
-            {
-                std::cerr << "SQL error: " << sqlite3_errmsg(database) << std::endl;
-            }
-            else
+        if (SQLITEDB_OK == rc)
+        {
+            for (Encoding encoding : dwarfEncodings)
             {
-                // Bind values to placeholders
-                sqlite3_bind_text(stmt, 1, encoding.getName().c_str(), -1, SQLITE_STATIC);
+                sqlite3_bind_text(stmt, 1, encoding.getName().c_str(), -1, SQLITE_TRANSIENT);
 
-                rc = sqlite3_step(stmt);
+                rc = stepStatement(stmt, "encodings");
 
-                // Execute the SQL statement
-                if (rc != SQLITE_DONE)
+                if (SQLITEDB_ERROR == rc)
                 {
-                    const char* errorMessage = sqlite3_errmsg(database);
-                    if (SQLITE_OK == rc)
-                    {
-                        logger.logDebug(
-                            "Elf values were written to the encodings schema with "
-                            "SQLITE_OK status.");
-                    }
-                    else
-                    {
-                        if (sqlite3_extended_errcode(database) == SQLITE_CONSTRAINT_UNIQUE)
-                        {
-                            logger.logDebug("%s.", errorMessage);
-                            rc = SQLITE_OK;
-                        }
-                        else
-                        {
-                            logger.logDebug("There was an error while writing data to the encodings table.");
-                            logger.logDebug("%s.", errorMessage);
-                            rc = SQLITEDB_ERROR;
-                        }
-                    }
+                    break;
                 }
 
-                // Finalize the statement
-                rc = sqlite3_finalize(stmt);
-                if (rc != SQLITE_OK)
-                {
-                    logger.logDebug("There was an error while finalizing the sql statement for encodings table.");
-                }
-                else
+                if (SQLITE_DONE == rc)
                 {
                     sqlite3_int64 lastRowId = sqlite3_last_insert_rowid(database);
 
@@ -1711,8 +2112,12 @@ int SQLiteDB::writeEncodingsToDatabase(ElfFile& inElf)
                         inElf.getDWARFEncoding(DW_ATE_ASCII).setId(lastRowId);
                     }
                 }
+
+                rc = SQLITEDB_OK;
             }
         }
+
+        sqlite3_finalize(stmt);
     }
     else
     {
@@ -1829,16 +2234,16 @@ int SQLiteDB::createSchemas(void)
 
     if (SQLITE_OK == rc)
     {
-        logger.logDebug(
-            "createElfSchema() created the elfs schema "
-            "successfully.");
+        JUICER_LOG_DEBUG(logger,
+                         "createElfSchema() created the elfs schema "
+                         "successfully.");
 
         rc = createSymbolSchema();
         if (SQLITE_OK == rc)
         {
-            logger.logDebug(
-                "createSymbolSchema() created the symbols schema "
-                "successfully.");
+            JUICER_LOG_DEBUG(logger,
+                             "createSymbolSchema() created the symbols schema "
+                             "successfully.");
 
             rc = createFieldsSchema();
 
@@ -1848,131 +2253,198 @@ int SQLiteDB::createSchemas(void)
 
                 if (SQLITE_OK == rc)
                 {
-                    logger.logDebug(
-                        "createDimensionsSchema() created the dimensions schema "
-                        "successfully.");
+                    JUICER_LOG_DEBUG(logger,
+                                     "createDimensionsSchema() created the dimensions schema "
+                                     "successfully.");
 
                     rc = createEnumerationSchema();
                     if (SQLITE_OK == rc)
                     {
-                        logger.logDebug(
-                            "createEnumerationSchema() created the enumerations schema "
-                            "successfully.");
+                        JUICER_LOG_DEBUG(logger,
+                                         "createEnumerationSchema() created the enumerations schema "
+                                         "successfully.");
 
                         rc = createArtifactsSchema();
                         if (SQLITE_OK == rc)
                         {
-                            logger.logDebug(
-                                "createArtifactsSchema() created the artifacts schema "
-                                "successfully.");
+                            JUICER_LOG_DEBUG(logger,
+                                             "createArtifactsSchema() created the artifacts schema "
+                                             "successfully.");
 
                             rc = createMacrosSchema();
                             if (SQLITE_OK == rc)
                             {
-                                logger.logDebug(
-                                    "createMacrosSchema() created the macros schema "
-                                    "successfully.");
+                                JUICER_LOG_DEBUG(logger,
+                                                 "createMacrosSchema() created the macros schema "
+                                                 "successfully.");
 
                                 rc = createVariablesSchema();
                                 if (SQLITE_OK == rc)
                                 {
-                                    logger.logDebug(
-                                        "createVariablesSchema() created the variables schema "
-                                        "successfully.");
+                                    JUICER_LOG_DEBUG(logger,
+                                                     "createVariablesSchema() created the variables schema "
+                                                     "successfully.");
 
                                     rc = createElfSectionsSchema();
                                     if (SQLITE_OK == rc)
                                     {
-                                        logger.logDebug(
-                                            "createElfSectionsSchema() created the variables schema "
-                                            "successfully.");
+                                        JUICER_LOG_DEBUG(logger,
+                                                         "createElfSectionsSchema() created the variables schema "
+                                                         "successfully.");
 
                                         rc = createElfSymbolTableSchema();
 
                                         if (SQLITE_OK == rc)
                                         {
-                                            logger.logDebug(
-                                                "createElfSymbolTableSchema() created the variables schema "
-                                                "successfully.");
+                                            JUICER_LOG_DEBUG(logger,
+                                                             "createElfSymbolTableSchema() created the variables schema "
+                                                             "successfully.");
 
                                             rc = createEncodingsTableSchema();
 
                                             if (SQLITE_OK == rc)
                                             {
-                                                logger.logDebug(
-                                                    "createEncodingsTableSchema() created the variables schema "
-                                                    "successfully.");
+                                                JUICER_LOG_DEBUG(logger,
+                                                                 "createEncodingsTableSchema() created the variables schema "
+                                                                 "successfully.");
+
+                                                rc = upgradeSchemas();
                                             }
                                             else
                                             {
-                                                logger.logDebug("createEncodingsTableSchema() failed.");
+                                                JUICER_LOG_DEBUG(logger, "createEncodingsTableSchema() failed.");
                                                 rc = SQLITEDB_ERROR;
                                             }
                                         }
                                         else
                                         {
-                                            logger.logDebug("createElfSectionsSchema() failed.");
+                                            JUICER_LOG_DEBUG(logger, "createElfSectionsSchema() failed.");
                                             rc = SQLITEDB_ERROR;
                                         }
                                     }
                                     else
                                     {
-                                        logger.logDebug("createElfSectionsSchema() failed.");
+                                        JUICER_LOG_DEBUG(logger, "createElfSectionsSchema() failed.");
                                         rc = SQLITEDB_ERROR;
                                     }
                                 }
                                 else
                                 {
-                                    logger.logDebug("createVariablesSchema() failed.");
+                                    JUICER_LOG_DEBUG(logger, "createVariablesSchema() failed.");
                                     rc = SQLITEDB_ERROR;
                                 }
                             }
                             else
                             {
-                                logger.logDebug("createMacrosSchema() failed.");
+                                JUICER_LOG_DEBUG(logger, "createMacrosSchema() failed.");
                                 rc = SQLITEDB_ERROR;
                             }
                         }
                         else
                         {
-                            logger.logDebug("createArtifactsSchema() failed.");
+                            JUICER_LOG_DEBUG(logger, "createArtifactsSchema() failed.");
                             rc = SQLITEDB_ERROR;
                         }
                     }
                     else
                     {
-                        logger.logDebug("createDimensionsSchema() failed.");
+                        JUICER_LOG_DEBUG(logger, "createDimensionsSchema() failed.");
                         rc = SQLITEDB_ERROR;
                     }
                 }
                 else
                 {
-                    logger.logDebug("createDimensionsSchema() failed.");
+                    JUICER_LOG_DEBUG(logger, "createDimensionsSchema() failed.");
                     rc = SQLITEDB_ERROR;
                 }
             }
             else
             {
-                logger.logDebug("createFieldsSchema() failed.");
+                JUICER_LOG_DEBUG(logger, "createFieldsSchema() failed.");
                 rc = SQLITEDB_ERROR;
             }
         }
         else
         {
-            logger.logDebug("createSymbolSchema() failed.");
+            JUICER_LOG_DEBUG(logger, "createSymbolSchema() failed.");
             rc = SQLITEDB_ERROR;
         }
     }
 
     else
     {
-        logger.logDebug("createElfSchema() failed.");
+        JUICER_LOG_DEBUG(logger, "createElfSchema() failed.");
         rc = SQLITEDB_ERROR;
     }
 
     return rc;
 }
 
+/**
+ *@brief Adds the columns that newer versions of juicer write to the tables of a database
+ *that an older version created. CREATE TABLE IF NOT EXISTS leaves such tables as they are.
+ *
+ *@return Returns SQLITE_OK if every table has all of its columns. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::upgradeSchemas(void)
+{
+    int rc = addMissingColumn("elfs", "checksum_algorithm", "TEXT NOT NULL DEFAULT 'md5'");
+
+    if (SQLITE_OK == rc)
+    {
+        rc = addMissingColumn("artifacts", "checksum_algorithm", "TEXT NOT NULL DEFAULT 'md5'");
+    }
+
+    return rc;
+}
+
+/**
+ *@brief Adds columnName, defined as columnDefinition, to tableName if the table does not have it yet.
+ *
+ *@return Returns SQLITE_OK if tableName has the column. Otherwise, SQLITEDB_ERROR.
+ */
+int SQLiteDB::addMissingColumn(const char* tableName, const char* columnName, const char* columnDefinition)
+{
+    sqlite3_stmt* stmt   = NULL;
+    std::string   sql    = std::string{"PRAGMA table_info("} + tableName + ");";
+    bool          exists = false;
+    int           rc     = prepareStatement(sql.c_str(), &stmt);
+
+    if (SQLITEDB_OK != rc)
+    {
+        return SQLITEDB_ERROR;
+    }
+
+    while (!exists && SQLITE_ROW == sqlite3_step(stmt))
+    {
+        /* The second column of table_info is the name of the column. */
+        exists = strcmp((const char*)sqlite3_column_text(stmt, 1), columnName) == 0;
+    }
+
+    sqlite3_finalize(stmt);
+
+    if (!exists)
+    {
+        char* errorMessage = NULL;
+
+        sql                = std::string{"ALTER TABLE "} + tableName + " ADD COLUMN " + columnName + " " + columnDefinition + ";";
+        rc                 = sqlite3_exec(database, sql.c_str(), NULL, NULL, &errorMessage);
+
+        if (SQLITE_OK == rc)
+        {
+            logger.logInfo("Added the %s column to the %s table.", columnName, tableName);
+        }
+        else
+        {
+            logger.logError("Failed to add the %s column to the %s table:%s.", columnName, tableName, errorMessage);
+            sqlite3_free(errorMessage);
+            rc = SQLITEDB_ERROR;
+        }
+    }
+
+    return rc;
+}
+
 /**
  *@brief Creates the elfs schema.
  *If the schema already exists, then this method does nothing.
@@ -1994,7 +2466,7 @@ int SQLiteDB::createElfSchema(void)
 
     if (SQLITE_OK == rc)
     {
-        logger.logDebug("Created table \"elfs\" with OK status");
+        JUICER_LOG_DEBUG(logger, "Created table \"elfs\" with OK status");
     }
     else
     {
@@ -2026,7 +2498,7 @@ int SQLiteDB::createSymbolSchema(void)
 
     if (SQLITE_OK == rc)
     {
-        logger.logDebug("Created table \"symbols\" with OK status");
+        JUICER_LOG_DEBUG(logger, "Created table \"symbols\" with OK status");
     }
     else
     {
@@ -2058,7 +2530,7 @@ int SQLiteDB::createFieldsSchema(void)
 
     if (SQLITE_OK == rc)
     {
-        logger.logDebug("Created table \"fields\" with OK status");
+        JUICER_LOG_DEBUG(logger, "Created table \"fields\" with OK status");
     }
     else
     {
@@ -2090,7 +2562,7 @@ int SQLiteDB::createDimensionsSchema(void)
 
     if (SQLITE_OK == rc)
     {
-        logger.logDebug("Created table \"dimensions\" with OK status");
+        JUICER_LOG_DEBUG(logger, "Created table \"dimensions\" with OK status");
     }
     else
     {
@@ -2123,7 +2595,7 @@ int SQLiteDB::createEnumerationSchema(void)
 
     if (SQLITE_OK == rc)
     {
-        logger.logDebug("Created table \"enumerations\" with OK status");
+        JUICER_LOG_DEBUG(logger, "Created table \"enumerations\" with OK status");
     }
     else
     {
@@ -2156,7 +2628,7 @@ int SQLiteDB::createArtifactsSchema(void)
 
     if (SQLITE_OK == rc)
     {
-        logger.logDebug("Created table \"artifacts\" with OK status");
+        JUICER_LOG_DEBUG(logger, "Created table \"artifacts\" with OK status");
     }
     else
     {
@@ -2189,7 +2661,7 @@ int SQLiteDB::createMacrosSchema(void)
 
     if (SQLITE_OK == rc)
     {
-        logger.logDebug("Created table \"artifacts\" with OK status");
+        JUICER_LOG_DEBUG(logger, "Created table \"artifacts\" with OK status");
     }
     else
     {
@@ -2222,7 +2694,7 @@ int SQLiteDB::createVariablesSchema(void)
 
     if (SQLITE_OK == rc)
     {
-        logger.logDebug("Created table \"artifacts\" with OK status");
+        JUICER_LOG_DEBUG(logger, "Created table \"artifacts\" with OK status");
     }
     else
     {
@@ -2255,7 +2727,7 @@ int SQLiteDB::createElfSectionsSchema(void)
 
     if (SQLITE_OK == rc)
     {
-        logger.logDebug("Created table \"artifacts\" with OK status");
+        JUICER_LOG_DEBUG(logger, "Created table \"artifacts\" with OK status");
     }
     else
     {
@@ -2288,7 +2760,7 @@ int SQLiteDB::createElfSymbolTableSchema(void)
 
     if (SQLITE_OK == rc)
     {
-        logger.logDebug("Created table \"artifacts\" with OK status");
+        JUICER_LOG_DEBUG(logger, "Created table \"artifacts\" with OK status");
     }
     else
     {
@@ -2312,7 +2784,7 @@ int SQLiteDB::createEncodingsTableSchema(void)
 
     if (SQLITE_OK == rc)
     {
-        logger.logDebug("Created table \"artifacts\" with OK status");
+        JUICER_LOG_DEBUG(logger, "Created table \"artifacts\" with OK status");
     }
     else
     {
@@ -14,9 +14,16 @@
 
 #include <sqlite3.h>
 
+#include <atomic>
 #include <map>
+#include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+#include "BoundedQueue.h"
 #include "ElfFile.h"
 #include "Enumeration.h"
 #include "IDataContainer.h"
@@ -25,11 +32,27 @@
 #define SQLITEDB_ERROR -1
 #define SQLITEDB_OK    0
 
+/**
+ * Pages copied per sqlite3_backup_step when an in-memory database is loaded or saved.
+ */
+#define SQLITEDB_BACKUP_STEP_PAGES 4096
+
+/**
+ * The first SQLite version, 3.24.0, that understands "INSERT ... ON CONFLICT DO NOTHING".
+ */
+#define SQLITEDB_UPSERT_VERSION    3024000
+
+/**
+ * Batches of symbols beginElf lets Juicer get ahead of the thread that writes them.
+ */
+#define SQLITEDB_PIPELINE_DEPTH    8
+
 #define CREATE_ELF_TABLE \
     "CREATE TABLE IF NOT EXISTS elfs (\
                                   id INTEGER PRIMARY KEY,\
-                                  name TEXT UNIQUE NOT NULL,\
+                                  name TEXT NOT NULL,\
                                   md5 TEXT NOT NULL,\
+                                  checksum_algorithm TEXT NOT NULL DEFAULT('md5'),\
                                   date DATETIME NOT NULL DEFAULT(CURRENT_TIMESTAMP),\
                                   little_endian BOOLEAN NOT NULL);"
 
@@ -37,7 +60,7 @@
     "CREATE TABLE IF NOT EXISTS symbols(\
                                   id INTEGER PRIMARY KEY,\
                                   elf INTEGER NOT NULL,\
-                                  name TEXT UNIQUE NOT NULL,\
+                                  name TEXT NOT NULL,\
                                   byte_size INTEGER NOT NULL,\
                                   artifact INTEGER,\
                                   target_symbol INTEGER,\
@@ -47,8 +70,7 @@
                                   FOREIGN KEY(elf) REFERENCES elfs(id),\
 								  FOREIGN KEY(artifact) REFERENCES artifacts(id)\
                                   FOREIGN KEY(target_symbol) REFERENCES symbols(id)\
-                                  FOREIGN KEY(encoding) REFERENCES encodings(id)\
-                                  UNIQUE(name));"
+                                  FOREIGN KEY(encoding) REFERENCES encodings(id));"
 
 #define CREATE_DIMENSION_TABLE \
     "CREATE TABLE IF NOT EXISTS dimension_lists (\
@@ -56,8 +78,7 @@
                                   field_id INTEGER NOT NULL,\
                                   dim_order INTEGER NOT NULL,\
                                   upper_bound INTEGER NOT NULL,\
-                                  FOREIGN KEY (field_id) REFERENCES fields(id),\
-                                  UNIQUE(field_id, dim_order, upper_bound));"
+                                  FOREIGN KEY (field_id) REFERENCES fields(id));"
 
 #define CREATE_FIELD_TABLE \
     "CREATE TABLE IF NOT EXISTS fields(\
@@ -72,8 +93,7 @@
                                   short_description TEXT ,\
                                   long_description TEXT ,\
                                   FOREIGN KEY (symbol) REFERENCES symbols(id),\
-                                  FOREIGN KEY (type) REFERENCES symbols(id),\
-                                  UNIQUE (symbol, name));"
+                                  FOREIGN KEY (type) REFERENCES symbols(id));"
 
 #define CREATE_ENUMERATION_TABLE \
     "CREATE TABLE IF NOT EXISTS enumerations(\
@@ -83,8 +103,7 @@
                                   name TEXT NOT NULL,\
                                   short_description TEXT ,\
                                   long_description TEXT ,\
-                                  FOREIGN KEY (symbol) REFERENCES symbols(id),\
-                                  UNIQUE (symbol, name));"
+                                  FOREIGN KEY (symbol) REFERENCES symbols(id));"
 
 #define CREATE_ARTIFACTS_TABLE \
     "CREATE TABLE IF NOT EXISTS artifacts(\
@@ -92,8 +111,8 @@
                                   elf INTEGER NOT NULL,\
                                   path TEXT NOT NULL,\
                                   md5 TEXT NOT NULL, \
-                                  FOREIGN KEY (elf) REFERENCES elfs(id),\
-                                  UNIQUE (path, md5));"
+                                  checksum_algorithm TEXT NOT NULL DEFAULT('md5'),\
+                                  FOREIGN KEY (elf) REFERENCES elfs(id));"
 
 #define CREATE_MACROS_TABLE \
     "CREATE TABLE IF NOT EXISTS macros(\
@@ -103,8 +122,7 @@
 								  module_id INTEGER,\
 								  source INTEGER,\
 								  short_description TEXT,\
-								  long_description TEXT,\
-                                  UNIQUE (name, value));"
+								  long_description TEXT);"
 
 #define CREATE_ELF_SECTIONS_TABLE \
     "CREATE TABLE IF NOT EXISTS elf_sections(\
@@ -147,14 +165,28 @@
 								  short_description TEXT,\
 								  long_description TEXT,\
 								  FOREIGN KEY (type) REFERENCES symbols(id),\
-								  FOREIGN KEY (elf) REFERENCES elfs(id),\
-                                  UNIQUE (name, type, elf));"
+								  FOREIGN KEY (elf) REFERENCES elfs(id));"
 
 #define CREATE_ENCODINGS_TABLE \
     "CREATE TABLE IF NOT EXISTS encodings(\
                                   id INTEGER PRIMARY KEY,\
-                                  encoding TEXT NOT NULL,\
-                                  UNIQUE (encoding));"
+                                  encoding TEXT NOT NULL);"
+
+/**
+ * The unique keys of the tables above. They are not part of the tables so that the first
+ * write into a new database can insert every row without maintaining them, and build
+ * each of them once at the end. See SQLiteDB::write.
+ */
+#define CREATE_UNIQUE_INDEXES \
+    "CREATE UNIQUE INDEX IF NOT EXISTS elfs_name ON elfs(name);\
+     CREATE UNIQUE INDEX IF NOT EXISTS symbols_name ON symbols(name);\
+     CREATE UNIQUE INDEX IF NOT EXISTS dimension_lists_field_id_dim_order_upper_bound ON dimension_lists(field_id, dim_order, upper_bound);\
+     CREATE UNIQUE INDEX IF NOT EXISTS fields_symbol_name ON fields(symbol, name);\
+     CREATE UNIQUE INDEX IF NOT EXISTS enumerations_symbol_name ON enumerations(symbol, name);\
+     CREATE UNIQUE INDEX IF NOT EXISTS artifacts_path_md5 ON artifacts(path, md5);\
+     CREATE UNIQUE INDEX IF NOT EXISTS macros_name_value ON macros(name, value);\
+     CREATE UNIQUE INDEX IF NOT EXISTS variables_name_type_elf ON variables(name, type, elf);\
+     CREATE UNIQUE INDEX IF NOT EXISTS encodings_encoding ON encodings(encoding);"
 
 //#define CREATE_DATA_OBJECTS_TABLE \
 //    "CREATE TABLE IF NOT EXISTS data_objects(\
@@ -178,10 +210,139 @@
 class SQLiteDB : public IDataContainer
 {
    private:
+    /**
+     * The rows of the artifacts, symbols, fields, dimensions and enumerations of some of
+     * the symbols of an elf. They are copied out of the elf, with every id they refer to,
+     * so that writeBatch can insert them on another thread while Juicer keeps adding to the elf.
+     */
+    struct ArtifactRow
+    {
+        sqlite3_int64  id;
+        InternedString path;
+        std::string    md5;
+    };
+
+    struct SymbolRow
+    {
+        sqlite3_int64  id;
+        InternedString name;
+        uint32_t       byteSize;
+        /* 0 is written as NULL. */
+        sqlite3_int64  encodingId;
+        sqlite3_int64  artifactId;
+        /* 0 is written as NULL. */
+        sqlite3_int64  targetSymbolId;
+        std::string    longDescription;
+        std::string    shortDescription;
+    };
+
+    struct FieldRow
+    {
+        /* Set by writeFieldRows once the field is written. */
+        sqlite3_int64         id;
+        sqlite3_int64         symbolId;
+        InternedString        name;
+        uint32_t              byteOffset;
+        sqlite3_int64         typeId;
+        bool                  littleEndian;
+        uint32_t              bitSize;
+        uint32_t              bitOffset;
+        std::string           longDescription;
+        std::string           shortDescription;
+        std::vector<uint32_t> upperBounds;
+    };
+
+    struct EnumerationRow
+    {
+        sqlite3_int64 symbolId;
+        int64_t       value;
+        std::string   name;
+        std::string   longDescription;
+        std::string   shortDescription;
+    };
+
+    struct SymbolBatch
+    {
+        std::vector<ArtifactRow>    artifacts;
+        std::vector<SymbolRow>      symbols;
+        std::vector<FieldRow>       fields;
+        std::vector<EnumerationRow> enumerations;
+    };
+
     sqlite3            *database;
     Logger              logger;
     std::vector<Symbol> symbols{};
+    /**
+     * Ids of the symbols in the database by name, and of the artifacts by path and checksum.
+     * Loaded by loadExistingIds on the first write and after a rollback. Names and paths
+     * are interned, so looking up a symbol or artifact hashes a pointer.
+     */
+    std::unordered_map<InternedString, sqlite3_int64>                                 symbolIds{};
+    /**
+     * The target_symbol of every symbol in the database that has one, by the id of the symbol.
+     */
+    std::unordered_map<sqlite3_int64, sqlite3_int64>                                  targetSymbolIds{};
+    std::unordered_map<InternedString, std::unordered_map<std::string, sqlite3_int64>> artifactIds{};
+    bool                                                                               existingIdsLoaded{false};
+    /**
+     * Set by checkUniqueIndexes when the unique indexes have not been built yet, which is the case
+     * until the first write into a new database commits. See write().
+     */
+    bool                                                                               bulkLoad{false};
+    /**
+     * Appended to the INSERTs of rows that may already exist, so that SQLite skips them instead of
+     * failing the statement. Empty when SQLite is older than SQLITEDB_UPSERT_VERSION.
+     */
+    std::string                                                                        onConflictClause{};
+    /**
+     * The ids write() gives the next artifact, symbol and field it inserts. Set by loadNextIds
+     * at the start of every write.
+     */
+    sqlite3_int64                                                                      nextArtifactId{1};
+    sqlite3_int64                                                                      nextSymbolId{1};
+    sqlite3_int64                                                                      nextFieldId{1};
+    /**
+     * The elf being written, between startElf and finishElf, and the INSERTs writeBatch runs.
+     */
+    sqlite3_int64                                                                      currentElfId{0};
+    std::string                                                                        currentChecksumAlgorithm{};
+    sqlite3_stmt                                                                      *insertArtifactStmt{nullptr};
+    sqlite3_stmt                                                                      *insertSymbolStmt{nullptr};
+    sqlite3_stmt                                                                      *insertFieldStmt{nullptr};
+    sqlite3_stmt                                                                      *insertDimensionStmt{nullptr};
+    sqlite3_stmt                                                                      *insertEnumerationStmt{nullptr};
+    /**
+     * Names of the fields and enumerations written so far, by symbol. Only kept while there is
+     * no unique index to skip them. See bulkLoad.
+     */
+    std::unordered_map<sqlite3_int64, std::unordered_set<InternedString>>              writtenFieldNames{};
+    std::unordered_map<sqlite3_int64, std::unordered_set<std::string>>                 writtenEnumerationNames{};
+    /**
+     * Between beginElf and endElf: how many of the elf's symbols have been batched, the fields and
+     * enumerations that were batched with them, the batches the writer thread has yet to write,
+     * and the outcome of the ones it has.
+     */
+    size_t                                                                             batchedSymbols{0};
+    std::unordered_set<const Field *>                                                  batchedFields{};
+    std::unordered_set<const Enumeration *>                                            batchedEnumerations{};
+    /**
+     * The encoding each symbol the elf added to the database was batched with, by the id of the
+     * symbol. Juicer may still set it after that. See writeSymbolEncodingsToDatabase.
+     */
+    std::unordered_map<sqlite3_int64, sqlite3_int64>                                  batchedEncodingIds{};
+    std::unique_ptr<BoundedQueue<SymbolBatch>>                                         pipeline{};
+    std::thread                                                                        writer{};
+    std::atomic<int>                                                                   writerResult{SQLITEDB_OK};
+    /**
+     * Set by setBuildInMemory. When the database is built in memory, destinationPath is the
+     * file close writes it to. It is empty otherwise.
+     */
+    bool                buildInMemory{false};
+    std::string         destinationPath{};
     int                 openDatabase(std::string &databaseName);
+    int                 openInMemoryDatabase(std::string &fileName);
+    int                 saveInMemoryDatabase(void);
+    int                 copyDatabase(sqlite3 *source, sqlite3 *destination);
     int                 createElfSchema(void);
     int                 createSymbolSchema(void);
     int                 createSchemas(void);
@@ -194,29 +355,57 @@ class SQLiteDB : public IDataContainer
     int                 createElfSectionsSchema(void);
     int                 createElfSymbolTableSchema(void);
     int                 createEncodingsTableSchema(void);
+    int                 upgradeSchemas(void);
+    int                 addMissingColumn(const char *tableName, const char *columnName, const char *columnDefinition);
     int                 writeElfToDatabase(ElfFile &inModule);
+    int                 deleteElfRows(sqlite3_int64 elfId);
     int                 writeMacrosToDatabase(ElfFile &inModule);
     int                 writeVariablesToDatabase(ElfFile &inModule);
     int                 writeElfSectionsToDatabase(ElfFile &inModule);
     int                 writeElfSymboltableSymbolsToDatabase(ElfFile &inModule);
-    int                 writeArtifactsToDatabase(ElfFile &inModule);
-    int                 writeSymbolsToDatabase(ElfFile &inModule);
-    int                 writeFieldsToDatabase(ElfFile &inModule);
-    int                 writeEnumerationsToDatabase(ElfFile &inModule);
-    int                 writeDimensionsListToDatabase(ElfFile &inElf);
+    int                 writeTargetSymbolsToDatabase(ElfFile &inModule);
+    int                 writeSymbolEncodingsToDatabase(ElfFile &inElf);
     int                 writeEncodingsToDatabase(ElfFile &inElf);
+    int                 startElf(ElfFile &inElf);
+    int                 finishElf(ElfFile &inElf, int rc);
+    int                 prepareInsertStatements(void);
+    void                finalizeInsertStatements(void);
+    void                addSymbolsToBatch(ElfFile &inElf, size_t first, SymbolBatch &batch);
+    void                addMembersToBatch(Symbol &symbol, SymbolBatch &batch);
+    int                 writeBatch(SymbolBatch &batch);
+    int                 writeArtifactRows(std::vector<ArtifactRow> &rows);
+    int                 writeSymbolRows(std::vector<SymbolRow> &rows);
+    int                 writeFieldRows(std::vector<FieldRow> &rows);
+    int                 writeDimensionRows(std::vector<FieldRow> &rows);
+    int                 writeEnumerationRows(std::vector<EnumerationRow> &rows);
+    void                runWriter(void);
+    int                 stopWriter(void);
+    int                 beginTransaction(void);
+    int                 commitTransaction(void);
+    void                rollbackTransaction(void);
+    void                logWriteStatus(int rc, const char *tableName);
+    int                 prepareStatement(const char *sql, sqlite3_stmt **stmt);
+    int                 stepStatement(sqlite3_stmt *stmt, const char *tableName);
+    int                 stepInsert(sqlite3_stmt *stmt, const char *tableName);
+    int                 loadExistingIds(void);
+    int                 loadNextIds(void);
+    int                 checkUniqueIndexes(void);
+    int                 createUniqueIndexes(void);
     static int          doesRowExistCallback(void *veryUsed, int argc, char **argv, char **azColName);
-    bool                doesSymbolExist(std::string name);
-    bool                doesArtifactExist(std::string name);
 
     bool                doEncodingsExist();
 
    public:
     SQLiteDB();
+    void        setBuildInMemory(bool inMemory) { buildInMemory = inMemory; }
     int         initialize(std::string &initString);
     static int  selectCallback(void *veryUsed, int argc, char **argv, char **azColName);
-    int         close(void);
+    virtual int close(void);
     virtual int write(ElfFile &inModule);
+    virtual int beginElf(ElfFile &inModule);
+    virtual int writeNewSymbols(ElfFile &inModule);
+    virtual int endElf(ElfFile &inModule, bool complete);
+    virtual bool hasElf(const std::string &name, const std::string &checksum, const std::string &algorithm);
     virtual ~SQLiteDB();
 };
 
@@ -0,0 +1,131 @@
+/*
+ * Stats.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "Stats.h"
+
+#include <iomanip>
+#include <sstream>
+
+const char           *Stats::phaseNames[STATS_PHASE_COUNT]     = {"dwarf_init",
+                                                                 "checksum",
+                                                                 "elf_sections",
+                                                                 "cu_walk",
+                                                                 "macros",
+                                                                 "db_elfs",
+                                                                 "db_artifacts",
+                                                                 "db_macros",
+                                                                 "db_encodings",
+                                                                 "db_symbols",
+                                                                 "db_fields",
+                                                                 "db_dimension_lists",
+                                                                 "db_enumerations",
+                                                                 "db_variables",
+                                                                 "db_elf_sections",
+                                                                 "db_elf_symbol_table",
+                                                                 "db_indexes",
+                                                                 "db_save"};
+
+const char           *Stats::counterNames[STATS_COUNTER_COUNT] = {"elfs",              "cus",                 "dies",                  "symbols",
+                                                                 "fields",            "enumerations",        "macros",                "variables",
+                                                                 "files_hashed",      "bytes_hashed",        "sql_statements",        "interned_strings",
+                                                                 "interned_bytes",    "macro_units_read",    "macro_units_reused",    "type_cache_hits",
+                                                                 "type_cache_misses", "checksum_cache_hits", "checksum_cache_misses"};
+
+std::atomic<uint64_t> Stats::phaseTimes[STATS_PHASE_COUNT]{};
+std::atomic<uint64_t> Stats::phaseCalls[STATS_PHASE_COUNT]{};
+std::atomic<uint64_t> Stats::counters[STATS_COUNTER_COUNT]{};
+
+Stats::Timer::Timer(StatsPhase_t phase) : phase{phase}, start{std::chrono::steady_clock::now()} {}
+
+Stats::Timer::~Timer()
+{
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    Stats::addTime(phase, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+void Stats::addTime(StatsPhase_t phase, uint64_t nanoseconds)
+{
+    phaseTimes[phase].fetch_add(nanoseconds, std::memory_order_relaxed);
+    phaseCalls[phase].fetch_add(1, std::memory_order_relaxed);
+}
+
+void     Stats::count(StatsCounter_t counter, uint64_t amount) { counters[counter].fetch_add(amount, std::memory_order_relaxed); }
+
+uint64_t Stats::getTime(StatsPhase_t phase) { return phaseTimes[phase]; }
+
+uint64_t Stats::getCalls(StatsPhase_t phase) { return phaseCalls[phase]; }
+
+uint64_t Stats::getCount(StatsCounter_t counter) { return counters[counter]; }
+
+void     Stats::reset(void)
+{
+    for (int i = 0; i < STATS_PHASE_COUNT; i++)
+    {
+        phaseTimes[i] = 0;
+        phaseCalls[i] = 0;
+    }
+
+    for (int i = 0; i < STATS_COUNTER_COUNT; i++)
+    {
+        counters[i] = 0;
+    }
+}
+
+/**
+ *@brief Formats every phase that ran and every counter as a table for people to read.
+ */
+std::string Stats::toTable(void)
+{
+    std::ostringstream table{};
+
+    table << std::left << std::setw(24) << "phase" << std::right << std::setw(14) << "time (ms)" << std::setw(10) << "calls" << "\n";
+
+    for (int i = 0; i < STATS_PHASE_COUNT; i++)
+    {
+        if (phaseCalls[i] > 0)
+        {
+            table << std::left << std::setw(24) << phaseNames[i] << std::right << std::setw(14) << std::fixed << std::setprecision(3) << phaseTimes[i] / 1e6
+                  << std::setw(10) << phaseCalls[i] << "\n";
+        }
+    }
+
+    table << "\n" << std::left << std::setw(24) << "counter" << std::right << std::setw(14) << "value" << "\n";
+
+    for (int i = 0; i < STATS_COUNTER_COUNT; i++)
+    {
+        table << std::left << std::setw(24) << counterNames[i] << std::right << std::setw(14) << counters[i] << "\n";
+    }
+
+    return table.str();
+}
+
+/**
+ *@brief Formats every phase and counter as a JSON object, for tracking performance across juicer versions.
+ *Times are in nanoseconds.
+ */
+std::string Stats::toJSON(void)
+{
+    std::ostringstream json{};
+
+    json << "{\"phases\":{";
+
+    for (int i = 0; i < STATS_PHASE_COUNT; i++)
+    {
+        json << (i > 0 ? "," : "") << "\"" << phaseNames[i] << "\":{\"time_ns\":" << phaseTimes[i] << ",\"calls\":" << phaseCalls[i] << "}";
+    }
+
+    json << "},\"counters\":{";
+
+    for (int i = 0; i < STATS_COUNTER_COUNT; i++)
+    {
+        json << (i > 0 ? "," : "") << "\"" << counterNames[i] << "\":" << counters[i];
+    }
+
+    json << "}}";
+
+    return json.str();
+}
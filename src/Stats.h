@@ -0,0 +1,109 @@
+/*
+ * Stats.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_STATS_H_
+#define SRC_STATS_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+/**
+ * Phases of a juicer run that Stats::Timer measures.
+ */
+typedef enum
+{
+    STATS_PHASE_DWARF_INIT = 0,
+    STATS_PHASE_CHECKSUM,
+    STATS_PHASE_ELF_SECTIONS,
+    STATS_PHASE_CU_WALK,
+    STATS_PHASE_MACROS,
+    STATS_PHASE_DB_ELFS,
+    STATS_PHASE_DB_ARTIFACTS,
+    STATS_PHASE_DB_MACROS,
+    STATS_PHASE_DB_ENCODINGS,
+    STATS_PHASE_DB_SYMBOLS,
+    STATS_PHASE_DB_FIELDS,
+    STATS_PHASE_DB_DIMENSION_LISTS,
+    STATS_PHASE_DB_ENUMERATIONS,
+    STATS_PHASE_DB_VARIABLES,
+    STATS_PHASE_DB_ELF_SECTIONS,
+    STATS_PHASE_DB_ELF_SYMBOL_TABLE,
+    STATS_PHASE_DB_INDEXES,
+    STATS_PHASE_DB_SAVE,
+    STATS_PHASE_COUNT
+} StatsPhase_t;
+
+/**
+ * Things Stats counts during a juicer run.
+ */
+typedef enum
+{
+    STATS_COUNTER_ELFS = 0,
+    STATS_COUNTER_CUS,
+    STATS_COUNTER_DIES,
+    STATS_COUNTER_SYMBOLS,
+    STATS_COUNTER_FIELDS,
+    STATS_COUNTER_ENUMERATIONS,
+    STATS_COUNTER_MACROS,
+    STATS_COUNTER_VARIABLES,
+    STATS_COUNTER_FILES_HASHED,
+    STATS_COUNTER_BYTES_HASHED,
+    STATS_COUNTER_SQL_STATEMENTS,
+    STATS_COUNTER_INTERNED_STRINGS,
+    STATS_COUNTER_INTERNED_BYTES,
+    STATS_COUNTER_MACRO_UNITS_READ,
+    STATS_COUNTER_MACRO_UNITS_REUSED,
+    STATS_COUNTER_TYPE_CACHE_HITS,
+    STATS_COUNTER_TYPE_CACHE_MISSES,
+    STATS_COUNTER_CHECKSUM_CACHE_HITS,
+    STATS_COUNTER_CHECKSUM_CACHE_MISSES,
+    STATS_COUNTER_COUNT
+} StatsCounter_t;
+
+/**
+ *@brief Process-wide timers and counters for the phases of a juicer run, reported by --stats.
+ *
+ *Everything is kept in atomics so the --jobs workers can add to the same numbers. A phase that
+ *runs on several threads at once, such as the CU walk, reports the time summed over all of them.
+ */
+class Stats
+{
+   public:
+    /**
+     *@brief Adds the time between its construction and destruction to a phase.
+     */
+    class Timer
+    {
+       public:
+        Timer(StatsPhase_t phase);
+        ~Timer();
+
+       private:
+        StatsPhase_t                                       phase;
+        std::chrono::time_point<std::chrono::steady_clock> start;
+    };
+
+    static void        addTime(StatsPhase_t phase, uint64_t nanoseconds);
+    static void        count(StatsCounter_t counter, uint64_t amount = 1);
+    static uint64_t    getTime(StatsPhase_t phase);
+    static uint64_t    getCalls(StatsPhase_t phase);
+    static uint64_t    getCount(StatsCounter_t counter);
+    static void        reset(void);
+    static std::string toTable(void);
+    static std::string toJSON(void);
+
+   private:
+    static const char           *phaseNames[STATS_PHASE_COUNT];
+    static const char           *counterNames[STATS_COUNTER_COUNT];
+    static std::atomic<uint64_t> phaseTimes[STATS_PHASE_COUNT];
+    static std::atomic<uint64_t> phaseCalls[STATS_PHASE_COUNT];
+    static std::atomic<uint64_t> counters[STATS_COUNTER_COUNT];
+};
+
+#endif /* SRC_STATS_H_ */
@@ -10,15 +10,18 @@
 #include "Enumeration.h"
 #include "Field.h"
 
+/* Shared by all symbols; a Logger per symbol costs a lock on creation and destruction. */
+Logger Symbol::logger;
+
 Symbol::Symbol(ElfFile& inElf)
     : elf{inElf},  // @suppress("Symbol is not resolved")
-      name{""},
+      name{},
       byte_size{0},
       artifact{elf},
       short_description{""},
       long_description{""}
 {
-    logger.logDebug("Symbol %s::%s (%u bytes) created.", elf.getName().c_str(), name.c_str(), byte_size);
+    JUICER_LOG_DEBUG(logger, "Symbol %s::%s (%u bytes) created.", elf.getName().c_str(), name.c_str(), byte_size);
 }
 
 Symbol::Symbol(ElfFile& inElf, std::string& inName, uint32_t inByteSize, Artifact inArtifact)
@@ -29,14 +32,25 @@ Symbol::Symbol(ElfFile& inElf, std::string& inName, uint32_t inByteSize, Artifac
       short_description{""},
       long_description{""}
 {
-    logger.logDebug("Symbol %s::%s (%u bytes) created.", elf.getName().c_str(), name.c_str(), byte_size);
+    JUICER_LOG_DEBUG(logger, "Symbol %s::%s (%u bytes) created.", elf.getName().c_str(), name.c_str(), byte_size);
+}
+
+Symbol::Symbol(ElfFile& inElf, const InternedString& inName, uint32_t inByteSize, Artifact inArtifact)
+    : elf{inElf},    // @suppress("Symbol is not resolved")
+      name{inName},  // @suppress("Symbol is not resolved")
+      byte_size{inByteSize},
+      artifact{inArtifact},
+      short_description{""},
+      long_description{""}
+{
+    JUICER_LOG_DEBUG(logger, "Symbol %s::%s (%u bytes) created.", elf.getName().c_str(), name.c_str(), byte_size);
 }
 
 Symbol::~Symbol() {}
 
 void Symbol::addField(Field& inField)
 {
-    logger.logDebug("Adding Field %s to Symbol %s.", inField.getName().c_str(), name.c_str());
+    JUICER_LOG_DEBUG(logger, "Adding Field %s to Symbol %s.", inField.getName().c_str(), name.c_str());
 
     addField(inField.getName(), inField.getByteOffset(), inField.getType(), inField.getDimensionList(), inField.isLittleEndian(), inField.getBitSize(),
              inField.getBitOffset());
@@ -48,14 +62,14 @@ void Symbol::addField(Field& inField)
  *unique_ptr, which is also called addField. Maybe we should place our
  *elf data structures inside a namespace called ElfData?
  */
-void Symbol::addField(std::string& inName, uint32_t inByteOffset, Symbol& inType, DimensionList& dimensionList, bool inLittleEndian, uint32_t inBitSize,
+void Symbol::addField(const std::string& inName, uint32_t inByteOffset, Symbol& inType, DimensionList& dimensionList, bool inLittleEndian, uint32_t inBitSize,
                       uint32_t inBitOffset)
 {
     Field* field = getField(inName);
 
     if (field == nullptr)
     {
-        fields.push_back(std::make_unique<Field>(*this, inName, inByteOffset, inType, dimensionList, inLittleEndian, inBitSize, inBitOffset));
+        fields.push_back(elf.getArena().create<Field>(*this, inName, inByteOffset, inType, dimensionList, inLittleEndian, inBitSize, inBitOffset));
     }
 }
 
@@ -65,24 +79,27 @@ void Symbol::addField(std::string& inName, uint32_t inByteOffset, Symbol& inType
  *unique_ptr, which is also called addField. Maybe we should place our
  *elf data structures inside a namespace called ElfData?
  */
-void Symbol::addField(std::string& inName, uint32_t inByteOffset, Symbol& inType, bool inLittleEndian, uint32_t inBitSize, uint32_t inBitOffset)
+void Symbol::addField(const std::string& inName, uint32_t inByteOffset, Symbol& inType, bool inLittleEndian, uint32_t inBitSize, uint32_t inBitOffset)
 {
     Field* field = getField(inName);
 
     if (field == nullptr)
     {
-        fields.push_back(std::make_unique<Field>(*this, inName, inByteOffset, inType, inLittleEndian, inBitSize, inBitOffset));
+        fields.push_back(elf.getArena().create<Field>(*this, inName, inByteOffset, inType, inLittleEndian, inBitSize, inBitOffset));
     }
 }
 
 void Symbol::addEnumeration(Enumeration& inEnumeration)
 {
-    logger.logDebug("Adding Enumeration %s:%i to Symbol %s.", inEnumeration.getName().c_str(), inEnumeration.getValue(), name.c_str());
+    JUICER_LOG_DEBUG(logger, "Adding Enumeration %s:%i to Symbol %s.", inEnumeration.getName().c_str(), inEnumeration.getValue(), name.c_str());
 
     addEnumeration(inEnumeration.getName(), inEnumeration.getValue());
 }
 
-void Symbol::addEnumeration(std::string& inName, int32_t inValue) { enumerations.push_back(std::make_unique<Enumeration>(*this, inName, inValue)); }
+void Symbol::addEnumeration(std::string& inName, int32_t inValue)
+{
+    enumerations.push_back(elf.getArena().create<Enumeration>(*this, inName, inValue));
+}
 
 Symbol::Symbol(const Symbol& inSymbol)
     : elf{inSymbol.elf},    // @suppress("Symbol is not resolved")
@@ -94,20 +111,26 @@ Symbol::Symbol(const Symbol& inSymbol)
     std::cout << "Copy constructor\n";
 }
 
-const std::string& Symbol::getName(void) const { return name; }
+const std::string&    Symbol::getName(void) const { return name.str(); }
 
-void               Symbol::setName(std::string& inName)
+const InternedString& Symbol::getInternedName(void) const { return name; }
+
+void                  Symbol::setName(std::string& inName)
 {
-    logger.logDebug("Symbol %s::%s renamed to %s::%s.", elf.getName().c_str(), name.c_str(), elf.getName().c_str(), inName.c_str());
+    JUICER_LOG_DEBUG(logger, "Symbol %s::%s renamed to %s::%s.", elf.getName().c_str(), name.c_str(), elf.getName().c_str(), inName.c_str());
+
+    InternedString oldName = name;
 
-    this->name = inName;
+    this->name             = InternedString{inName};
+
+    elf.renameSymbol(oldName, *this);
 }
 
 uint32_t Symbol::getByteSize() const { return byte_size; }
 
 void     Symbol::setByteSize(uint32_t inByteSize)
 {
-    logger.logDebug("Symbol %s::%s byte size changed from %d to %d.", elf.getName().c_str(), name.c_str(), byte_size, inByteSize);
+    JUICER_LOG_DEBUG(logger, "Symbol %s::%s byte size changed from %d to %d.", elf.getName().c_str(), name.c_str(), byte_size, inByteSize);
 
     this->byte_size = inByteSize;
 }
@@ -118,9 +141,9 @@ uint32_t                                   Symbol::getId(void) const { return id
 
 ElfFile&                                   Symbol::getElf() { return elf; }
 
-std::vector<std::unique_ptr<Enumeration>>& Symbol::getEnumerations() { return enumerations; }
+std::vector<Enumeration*>&                 Symbol::getEnumerations() { return enumerations; }
 
-std::vector<std::unique_ptr<Field>>&       Symbol::getFields() { return fields; }
+std::vector<Field*>&                       Symbol::getFields() { return fields; }
 
 /**
  *@brief Iterates through all of the possible fields and finds the field with
@@ -139,22 +162,29 @@ std::vector<std::unique_ptr<Field>>&       Symbol::getFields() { return fields;
  *nonetheless. Will re-evaluate. Visit https://en.cppreference.com/w/cpp/utility/optional
  *and https://en.cppreference.com/w/cpp/utility/tuple for details.
  */
-Field*                                     Symbol::getField(std::string& fieldName) const
+Field*                                     Symbol::getField(const std::string& fieldName) const
 {
-    Field* outField = nullptr;
+    Field*         outField = nullptr;
+    InternedString internedName{};
+
+    /* A name that was never interned cannot belong to any field. */
+    if (!InternedString::find(fieldName, internedName))
+    {
+        return outField;
+    }
 
     for (auto&& field : fields)
     {
-        if (field->getName() == fieldName)
+        if (field->getInternedName() == internedName)
         {
-            return field.get();
+            return field;
         }
     }
 
     return outField;
 }
 
-bool Symbol::isFieldUnique(std::string& name)
+bool Symbol::isFieldUnique(const std::string& name)
 {
     bool   rc    = false;
     Field* field = getField(name);
@@ -19,6 +19,7 @@
 #include "Encoding.h"
 #include "Enumeration.h"
 #include "Field.h"
+#include "InternedString.h"
 #include "Logger.h"
 
 class Field;
@@ -34,10 +35,12 @@ class Symbol
    public:
     Symbol(ElfFile &elf);
     Symbol(ElfFile &elf, std::string &name, uint32_t byte_size, Artifact);
+    Symbol(ElfFile &elf, const InternedString &name, uint32_t byte_size, Artifact);
     Symbol(ElfFile &elf, std::string &name, uint32_t byte_size, Artifact, Symbol &targetSymbol);
     virtual ~Symbol();
-    const std::string &getName(void) const;
-    void               setName(std::string &name);
+    const std::string    &getName(void) const;
+    const InternedString &getInternedName(void) const;
+    void                  setName(std::string &name);
     uint32_t           getByteSize() const;
     void               setByteSize(uint32_t byteSize);
     ElfFile           &getElf();
@@ -45,16 +48,16 @@ class Symbol
     uint32_t           getId(void) const;
     Symbol(const Symbol &symbol);
     void addField(Field &inField);
-    void addField(std::string &inName, uint32_t inByteOffset, Symbol &inType, DimensionList &dimensionList, bool inLittleEndian, uint32_t inBitSize = 0,
+    void addField(const std::string &inName, uint32_t inByteOffset, Symbol &inType, DimensionList &dimensionList, bool inLittleEndian, uint32_t inBitSize = 0,
                   uint32_t inBitOffset = 0);
-    void addField(std::string &inName, uint32_t inByteOffset, Symbol &inType, bool inLittleEndian, uint32_t inBitSize = 0, uint32_t inBitOffset = 0);
+    void addField(const std::string &inName, uint32_t inByteOffset, Symbol &inType, bool inLittleEndian, uint32_t inBitSize = 0, uint32_t inBitOffset = 0);
     void addEnumeration(Enumeration &inEnumeration);
     void addEnumeration(std::string &name, int32_t value);
-    std::vector<std::unique_ptr<Enumeration>> &getEnumerations();
-    std::vector<std::unique_ptr<Field>>       &getFields();
+    std::vector<Enumeration *>                &getEnumerations();
+    std::vector<Field *>                      &getFields();
     bool                                       hasBitFields();
-    bool                                       isFieldUnique(std::string &name);
-    Field                                     *getField(std::string &name) const;
+    bool                                       isFieldUnique(const std::string &name);
+    Field                                     *getField(const std::string &name) const;
     Artifact                                  &getArtifact();
 
     const std::string                         &getShortDescription() const { return short_description; }
@@ -75,12 +78,15 @@ class Symbol
 
    private:
     ElfFile                                  &elf;
-    std::string                               name;
+    InternedString                            name;
     uint32_t                                  byte_size;
-    Logger                                    logger;
+    static Logger                             logger;
     uint32_t                                  id;
-    std::vector<std::unique_ptr<Field>>       fields;
-    std::vector<std::unique_ptr<Enumeration>> enumerations;
+    /**
+     * Owned by the arena of elf.
+     */
+    std::vector<Field *>                      fields;
+    std::vector<Enumeration *>                enumerations;
     Artifact                                  artifact;
     Symbol                                   *targetSymbol{nullptr};  // This is useful for typedef'd names
 
@@ -0,0 +1,112 @@
+/*
+ * SymbolMemberView.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_SYMBOLMEMBERVIEW_H_
+#define SRC_SYMBOLMEMBERVIEW_H_
+
+#include <stddef.h>
+
+#include <iterator>
+#include <vector>
+
+class Symbol;
+
+/**
+ *@brief Read-only range over one kind of member, such as the fields, of every symbol in a list.
+ *
+ *Iterating walks the symbols' own vectors in place, so unlike collecting the members into
+ *a new vector it allocates nothing, however often it is done.
+ *
+ *@param T The member type.
+ *@param getMembers Returns the members of a symbol. Taking a function instead of a member
+ *pointer lets this be named where Symbol is still incomplete, such as in ElfFile.h.
+ *
+ *@note Like any iterator over a std::vector, this is invalidated by adding symbols or members.
+ */
+template <typename T, std::vector<T *> &(*getMembers)(Symbol &)>
+class SymbolMemberView
+{
+   public:
+    class Iterator
+    {
+       public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T                        *value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef T *const                 *pointer;
+        typedef T                        *reference;
+
+        Iterator(std::vector<Symbol *>::const_iterator inSymbol, std::vector<Symbol *>::const_iterator inEnd) : symbol{inSymbol}, end{inEnd}
+        {
+            skipSymbolsWithoutMembers();
+        }
+
+        T        *operator*() const { return (*members)[index]; }
+
+        Iterator &operator++()
+        {
+            if (++index == members->size())
+            {
+                ++symbol;
+                index = 0;
+                skipSymbolsWithoutMembers();
+            }
+
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const Iterator &other) const { return symbol == other.symbol && index == other.index; }
+        bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+       private:
+        void skipSymbolsWithoutMembers()
+        {
+            for (; symbol != end; ++symbol)
+            {
+                members = &getMembers(**symbol);
+
+                if (!members->empty())
+                {
+                    break;
+                }
+            }
+        }
+
+        std::vector<Symbol *>::const_iterator symbol;
+        std::vector<Symbol *>::const_iterator end;
+        std::vector<T *>                     *members{nullptr};
+        size_t                                index{0};
+    };
+
+    SymbolMemberView(const std::vector<Symbol *> &inSymbols) : symbols{inSymbols} {}
+
+    Iterator begin() const { return Iterator{symbols.begin(), symbols.end()}; }
+    Iterator end() const { return Iterator{symbols.end(), symbols.end()}; }
+
+    size_t   size() const
+    {
+        size_t count = 0;
+
+        for (auto &&symbol : symbols)
+        {
+            count += getMembers(*symbol).size();
+        }
+
+        return count;
+    }
+
+   private:
+    const std::vector<Symbol *> &symbols;
+};
+
+#endif /* SRC_SYMBOLMEMBERVIEW_H_ */
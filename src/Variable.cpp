@@ -12,7 +12,7 @@ Variable::Variable(std::string newName, Symbol& newType, ElfFile& newElf) : name
     // TODO Auto-generated constructor stub
 }
 
-const std::string& Variable::getName() const { return name; }
+const std::string& Variable::getName() const { return name.str(); }
 
 const Symbol&      Variable::getType() const { return type; }
 
@@ -10,12 +10,15 @@
 
 #include <string>
 
+#include "InternedString.h"
 #include "Symbol.h"
 
 class Variable
 {
    public:
     Variable(std::string newName, Symbol& newType, ElfFile& newElf);
+    Variable(const Variable&) = default;
+    Variable(Variable&&)      = default;
     virtual ~Variable();
 
     const std::string& getName() const;
@@ -28,12 +31,12 @@ class Variable
     const std::string& getLongDescription() const;
 
    private:
-    std::string name;
-    Symbol&     type;
-    ElfFile&    elf;
+    InternedString name;
+    Symbol&        type;
+    ElfFile&       elf;
 
-    std::string short_description{""};
-    std::string long_description{""};
+    std::string    short_description{""};
+    std::string    long_description{""};
 };
 
 #endif /* SRC_VARIABLE_H_ */
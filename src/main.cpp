@@ -36,12 +36,18 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <fstream>
 #include <iostream>
+#include <string>
+#include <vector>
 
+#include "FileChecksum.h"
 #include "IDataContainer.h"
+#include "InternedString.h"
 #include "Juicer.h"
 #include "Logger.h"
 #include "SQLiteDB.h"
+#include "Stats.h"
 #include "TestSymbolsA.h"
 #include "TestSymbolsB.h"
 
@@ -55,18 +61,25 @@ static char doc[] =
 
 /* A description of the arguments we accept. */
 static char args_doc[] =
-    "--input <FILE> --mode <MODE> (--output <FILE> | "
+    "(--input <FILE>... | --manifest <FILE>) --mode <MODE> (--output <FILE> | "
     "(--address <ADDR> --port <PORT> --project <PROJ>)) -x -g";
 
 /* The options we understand. */
-static struct argp_option options[] = {{"input", 'i', "FILE", 0, "Input ELF file"},
+static struct argp_option options[] = {{"input", 'i', "FILE", 0, "Input ELF file. May be given more than once to juice several ELF files into the same output."},
+                                       {"manifest", 'f', "FILE", 0, "FILE listing input ELF files, one per line. Empty lines and lines starting with # are ignored."},
                                        {"verbosity", 'v', "LEVEL", 0,
                                         "Set verbosity LEVEL, 0-4 (default 1). "
                                         "0=Silent, 1=Errors, 2=Warnings, 3=Info, "
                                         "4=Debug"},
                                        {"log", 'l', "FILE", 0, "Output log FILE"},
+                                       {"log-format", 'L', "FORMAT", 0,
+                                        "Log FORMAT. text (default) or jsonl, one JSON record per message with its event code, CU, DIE "
+                                        "and symbol. Read jsonl logs with read_log.py."},
                                        {"mode", 'm', "MODE", 0, "Output mode.  SQLITE,CCDD"},
                                        {"output", 'o', "FILE", 0, "Sqlite3 database FILE.  Required for SQLITE mode."},
+                                       {"in-memory", 'B', NULL, 0,
+                                        "Build the Sqlite3 database in memory and write it to FILE only when juicer is done. "
+                                        "FILE is replaced in one step, so a failed run leaves it as it was."},
                                        {"address", 'a', "ADDRESS", 0, "Postgresql server address.  Required for CCDD mode."},
                                        {"port", 'p', "PORT", 0, "Postgresql server port.  Required for CCDD mode."},
                                        {"user", 'u', "USER", 0, "Postgresql user.  Required for CCDD mode."},
@@ -74,10 +87,28 @@ static struct argp_option options[] = {{"input", 'i', "FILE", 0, "Input ELF file
                                        {"extras", 'x', NULL, 0,
                                         "Extra DWARF and ELF data such as variables. Enabling this"
                                         "will cause juicer to take longer."},
+                                       {"macros", 'M', NULL, 0,
+                                        "Extract #define macros from the DWARF macro sections. The ELF must be built with -g3. "
+                                        "Enabling this will cause juicer to take longer."},
                                        {"groupNumber", 'g', "group", 0,
                                         "Group number to extract data forom inside of DWARF section."
                                         "Useful for situations where debug sections (eg. debug_macros) are spreadout through different groups."
                                         " An example of this is when macros are split in different groups by gcc for unlinked ELF object files."},
+                                       {"jobs", 'J', "N", 0, "Number of threads used to read compilation units (default 1)."},
+                                       {"pipeline", 'P', NULL, 0,
+                                        "Write the symbols of each CU on a second thread while the next CUs are read, instead of "
+                                        "writing the whole ELF once it is read. Only used with one job."},
+                                       {"checksum-cache", 'c', "FILE", 0,
+                                        "Keep the checksums of the ELF and its artifacts in FILE so files that did not change "
+                                        "are not hashed again on the next run."},
+                                       {"incremental", 'I', NULL, 0,
+                                        "Skip the input ELF files that are already in the output with the same checksum. "
+                                        "Only ELF files that changed since they were last juiced are read."},
+                                       {"stats", 's', NULL, 0, "Print how long each phase took and how much was read and written at the end of the run."},
+                                       {"stats-json", 'S', "FILE", 0, "Write the same numbers as --stats to FILE as JSON."},
+                                       {"checksum", 'H', "ALGORITHM", 0,
+                                        "Checksum ALGORITHM for the ELF and its artifacts. md5 (default) or xxh64. "
+                                        "xxh64 is much faster but not cryptographic."},
                                        {0}};
 
 /* Used by main to communicate with parse_opt. */
@@ -85,15 +116,20 @@ typedef struct
 {
     char              *input;
     bool               input_set;
+    std::vector<std::string> *inputs;
+    char              *manifest;
+    bool               manifest_set;
     int                verbosity;
     bool               verbosity_set;
     char              *log;
     bool               log_set;
+    LoggerFormat_t     logFormat;
     char              *outputMode;
     JuicerOutputMode_t outputModeEnum;
     bool               outputMode_set;
     char              *output;
     bool               output_set;
+    bool               inMemory;
     char              *address;
     bool               address_set;
     int                port;
@@ -103,9 +139,33 @@ typedef struct
     char              *project;
     bool               project_set;
     bool               extras;
+    bool               macros;
+    bool               incremental;
+    bool               pipeline;
+    bool               stats;
+    char              *statsJSON;
+    bool               statsJSON_set;
     int                groupNumber;
+    int                jobs;
+    char              *checksumCache;
+    bool               checksumCache_set;
+    FileChecksum::Algorithm checksumAlgorithm;
 } arguments_t;
 
+/* Tells whether every character of arg is a digit. */
+static bool isNumber(const char *arg)
+{
+    for (size_t i = 0; i < strlen(arg); i++)
+    {
+        if (isdigit(arg[i]) == 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /* Parse a single option. */
 static error_t parse_opt(int key, char *arg, struct argp_state *state)
 {
@@ -119,6 +179,20 @@ static error_t parse_opt(int key, char *arg, struct argp_state *state)
         {
             arguments->input     = arg;
             arguments->input_set = true;
+            arguments->inputs->push_back(arg);
+            break;
+        }
+
+        case 'B':
+        {
+            arguments->inMemory = true;
+            break;
+        }
+
+        case 'f':
+        {
+            arguments->manifest     = arg;
+            arguments->manifest_set = true;
             break;
         }
 
@@ -185,22 +259,100 @@ static error_t parse_opt(int key, char *arg, struct argp_state *state)
             break;
         }
 
+        case 'M':
+        {
+            arguments->macros = true;
+            break;
+        }
+
+        case 'I':
+        {
+            arguments->incremental = true;
+            break;
+        }
+
+        case 'P':
+        {
+            arguments->pipeline = true;
+            break;
+        }
+
+        case 's':
+        {
+            arguments->stats = true;
+            break;
+        }
+
+        case 'S':
+        {
+            arguments->statsJSON     = arg;
+            arguments->statsJSON_set = true;
+            break;
+        }
+
         case 'g':
         {
-            for (int i = 0; i < strlen(arg); i++)
+            if (!isNumber(arg))
             {
-                if (isdigit(arg[i]) == 0)
-                {
-                    printf("Error: group number MUST be a number");
-                    argp_usage(state);
-                    return ARGP_KEY_ERROR;
-                }
+                printf("Error:  Group number must be a number.\n");
+                argp_usage(state);
+                return ARGP_KEY_ERROR;
             }
 
             arguments->groupNumber = atoi(arg);
             break;
         }
 
+        case 'J':
+        {
+            if (!isNumber(arg))
+            {
+                printf("Error:  Jobs must be a number.\n");
+                argp_usage(state);
+                return ARGP_KEY_ERROR;
+            }
+
+            arguments->jobs = atoi(arg);
+            break;
+        }
+
+        case 'c':
+        {
+            arguments->checksumCache     = arg;
+            arguments->checksumCache_set = true;
+            break;
+        }
+
+        case 'L':
+        {
+            if (strcmp(arg, "text") == 0)
+            {
+                arguments->logFormat = LOGGER_FORMAT_TEXT;
+            }
+            else if (strcmp(arg, "jsonl") == 0)
+            {
+                arguments->logFormat = LOGGER_FORMAT_JSONL;
+            }
+            else
+            {
+                printf("Error:  Invalid log format.\n");
+                argp_usage(state);
+                return ARGP_KEY_ERROR;
+            }
+            break;
+        }
+
+        case 'H':
+        {
+            if (FileChecksum::getAlgorithmFromName(arg, arguments->checksumAlgorithm) == false)
+            {
+                printf("Error:  Invalid checksum algorithm.\n");
+                argp_usage(state);
+                return ARGP_KEY_ERROR;
+            }
+            break;
+        }
+
         case ARGP_KEY_ARG:
         {
             //    	    if (state->arg_num >= 2)
@@ -216,7 +368,7 @@ static error_t parse_opt(int key, char *arg, struct argp_state *state)
         case ARGP_KEY_END:
         {
             /* Verify arguments, starting with the input file. */
-            if (arguments->input_set == false)
+            if (arguments->input_set == false && arguments->manifest_set == false)
             {
                 printf("Error:  Input file not set.\n");
                 argp_usage(state);
@@ -314,6 +466,14 @@ static error_t parse_opt(int key, char *arg, struct argp_state *state)
                 return ARGP_KEY_ERROR;
             }
 
+            /* Verify jobs. */
+            if (arguments->jobs < 1)
+            {
+                printf("Error:  Jobs must be 1 or greater.\n");
+                argp_usage(state);
+                return ARGP_KEY_ERROR;
+            }
+
             break;
         }
 
@@ -331,14 +491,20 @@ static struct argp argp = {options, parse_opt, args_doc, doc};
 
 int                main(int argc, char **argv)
 {
-    arguments_t arguments;
-    error_t     parse_error;
+    arguments_t              arguments;
+    error_t                  parse_error;
+    std::vector<std::string> inputs{};
+    int                      rc = JUICER_OK;
 
     /* Set argument default values. */
     memset(&arguments, 0, sizeof(arguments));
     arguments.verbosity   = 1;
     arguments.extras      = false;
+    arguments.macros      = false;
     arguments.groupNumber = 0;
+    arguments.jobs        = 1;
+    arguments.checksumAlgorithm = FileChecksum::ALGORITHM_MD5;
+    arguments.inputs            = &inputs;
 
     /* Parse our arguments; every option seen by parse_opt will
      be reflected in arguments. */
@@ -347,11 +513,18 @@ int                main(int argc, char **argv)
     {
         Juicer juicer;
         juicer.setExtras(arguments.extras);
+        juicer.setMacros(arguments.macros);
         juicer.setGroupNumber(arguments.groupNumber);
+        juicer.setJobs(arguments.jobs);
+        juicer.setIncremental(arguments.incremental);
+        juicer.setPipeline(arguments.pipeline);
+        juicer.setChecksumAlgorithm(arguments.checksumAlgorithm);
         IDataContainer *idc    = 0;
 
         Logger          logger = Logger(arguments.verbosity);
 
+        logger.setLogFormat(arguments.logFormat);
+
         if (arguments.log_set)
         {
             logger.setLogFile(arguments.log);
@@ -359,13 +532,53 @@ int                main(int argc, char **argv)
         }
 
         logger.logDebug("Verbosity %u", arguments.verbosity);
-        logger.logDebug("Input file '%s'", arguments.input);
+        if (arguments.manifest_set)
+        {
+            std::ifstream manifest{arguments.manifest};
+            std::string   line{};
+
+            if (!manifest)
+            {
+                logger.logError("Failed to open manifest '%s'.", arguments.manifest);
+                return (-1);
+            }
+
+            while (std::getline(manifest, line))
+            {
+                size_t first = line.find_first_not_of(" \t\r");
+                size_t last  = line.find_last_not_of(" \t\r");
+
+                if (first != std::string::npos && line.at(first) != '#')
+                {
+                    inputs.push_back(line.substr(first, last - first + 1));
+                }
+            }
+        }
+
+        for (auto &&input : inputs)
+        {
+            logger.logDebug("Input file '%s'", input.c_str());
+        }
+
+        if (arguments.checksumCache_set)
+        {
+            logger.logDebug("Checksum cache '%s'", arguments.checksumCache);
+            juicer.setChecksumCacheFile(arguments.checksumCache);
+        }
+
         logger.logDebug("Output Mode %s", arguments.outputMode);
         if (arguments.outputModeEnum == JUICER_OUTPUT_MODE_SQLITE)
         {
             logger.logDebug("SQLITE output file '%s'", arguments.output);
 
-            idc = IDataContainer::Create(IDC_TYPE_SQLITE, arguments.output);
+            if (arguments.inMemory)
+            {
+                idc = IDataContainer::Create(IDC_TYPE_SQLITE_IN_MEMORY, arguments.output);
+            }
+            else
+            {
+                idc = IDataContainer::Create(IDC_TYPE_SQLITE, arguments.output);
+            }
         }
         else if (arguments.outputModeEnum == JUICER_OUTPUT_MODE_CCDD)
         {
@@ -380,11 +593,41 @@ int                main(int argc, char **argv)
 
         logger.logInfo("Parsing");
 
-        std::string modernInput{arguments.input};
+        rc = juicer.parse(inputs);
+
+        if (idc != nullptr && idc->close() != JUICER_OK)
+        {
+            logger.logError("Failed to close the data container.");
+            rc = JUICER_ERROR;
+        }
+
+        Stats::count(STATS_COUNTER_INTERNED_STRINGS, InternedString::getPoolSize());
+        Stats::count(STATS_COUNTER_INTERNED_BYTES, InternedString::getPoolBytes());
+
+        if (arguments.stats)
+        {
+            std::cout << Stats::toTable();
+        }
+
+        if (arguments.statsJSON_set)
+        {
+            std::ofstream statsFile{arguments.statsJSON};
 
-        juicer.parse(modernInput);
+            statsFile << Stats::toJSON() << "\n";
+
+            if (!statsFile)
+            {
+                logger.logError("Failed to write stats to '%s'.", arguments.statsJSON);
+            }
+        }
 
         logger.logInfo("Done");
+
+        if (JUICER_OK != rc)
+        {
+            /* An input could not be juiced, or the output not be written.  Return an error. */
+            return (-1);
+        }
     }
     else
     {
@@ -0,0 +1,75 @@
+/*
+ * TestBoundedQueue.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <thread>
+#include <vector>
+
+#include "../src/BoundedQueue.h"
+#include "catch.hpp"
+
+TEST_CASE("A bounded queue hands items from one thread to another in order", "[BoundedQueue]")
+{
+    const int         itemCount = 10000;
+    BoundedQueue<int> queue{4};
+    std::vector<int>  popped{};
+
+    std::thread       consumer([&]() {
+        int item = 0;
+
+        while (queue.pop(item))
+        {
+            popped.push_back(item);
+        }
+    });
+
+    for (int i = 0; i < itemCount; i++)
+    {
+        REQUIRE(queue.push(i));
+    }
+
+    queue.close();
+    consumer.join();
+
+    REQUIRE(popped.size() == static_cast<size_t>(itemCount));
+
+    for (int i = 0; i < itemCount; i++)
+    {
+        REQUIRE(popped[i] == i);
+    }
+}
+
+TEST_CASE("A closed bounded queue gives up what it holds and takes nothing more", "[BoundedQueue]")
+{
+    BoundedQueue<int> queue{2};
+    int               item = 0;
+
+    REQUIRE(queue.push(1));
+    REQUIRE(queue.push(2));
+
+    queue.close();
+
+    REQUIRE(queue.push(3) == false);
+    REQUIRE(queue.pop(item));
+    REQUIRE(item == 1);
+    REQUIRE(queue.pop(item));
+    REQUIRE(item == 2);
+    REQUIRE(queue.pop(item) == false);
+}
+
+TEST_CASE("Closing a full bounded queue releases a waiting producer", "[BoundedQueue]")
+{
+    BoundedQueue<int> queue{1};
+    bool              pushed = true;
+
+    REQUIRE(queue.push(1));
+
+    std::thread producer([&]() { pushed = queue.push(2); });
+
+    queue.close();
+    producer.join();
+
+    REQUIRE(pushed == false);
+}
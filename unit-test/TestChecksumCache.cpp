@@ -0,0 +1,58 @@
+/*
+ * TestChecksumCache.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <stdio.h>
+
+#include "../src/ChecksumCache.h"
+#include "catch.hpp"
+
+TEST_CASE("Checksum cache hits only for the same algorithm, mtime and size", "[ChecksumCache]")
+{
+    ChecksumCache cache{};
+    std::string   checksum{};
+
+    REQUIRE(cache.lookup("/tmp/a.c", "md5", 100, 10, checksum) == false);
+    REQUIRE(cache.getMisses() == 1);
+
+    cache.insert("/tmp/a.c", "md5", 100, 10, "abcdef");
+
+    REQUIRE(cache.lookup("/tmp/a.c", "md5", 100, 10, checksum) == true);
+    REQUIRE(checksum == "abcdef");
+    REQUIRE(cache.getHits() == 1);
+
+    REQUIRE(cache.lookup("/tmp/a.c", "md5", 101, 10, checksum) == false);
+    REQUIRE(cache.lookup("/tmp/a.c", "md5", 100, 11, checksum) == false);
+    REQUIRE(cache.lookup("/tmp/a.c", "xxh64", 100, 10, checksum) == false);
+    REQUIRE(cache.getMisses() == 4);
+}
+
+TEST_CASE("Checksum cache survives a save and load", "[ChecksumCache]")
+{
+    std::string   cacheFilePath{"checksum_cache_test.txt"};
+    ChecksumCache cache{};
+    ChecksumCache loadedCache{};
+    std::string   checksum{};
+
+    cache.insert("/tmp/a.c", "md5", 100, 10, "abcdef");
+    cache.insert("/tmp/dir with spaces/b.h", "md5", -5, 0, "012345");
+
+    REQUIRE(cache.save(cacheFilePath) == CHECKSUMCACHE_OK);
+    REQUIRE(loadedCache.load(cacheFilePath) == CHECKSUMCACHE_OK);
+
+    REQUIRE(loadedCache.lookup("/tmp/a.c", "md5", 100, 10, checksum) == true);
+    REQUIRE(checksum == "abcdef");
+    REQUIRE(loadedCache.lookup("/tmp/dir with spaces/b.h", "md5", -5, 0, checksum) == true);
+    REQUIRE(checksum == "012345");
+
+    REQUIRE(remove(cacheFilePath.c_str()) == 0);
+}
+
+TEST_CASE("Loading a missing checksum cache is not an error", "[ChecksumCache]")
+{
+    ChecksumCache cache{};
+
+    REQUIRE(cache.load("does_not_exist_checksum_cache.txt") == CHECKSUMCACHE_OK);
+}
@@ -7,6 +7,9 @@
 
 #include <limits.h>
 
+#include <chrono>
+
+#include "../src/Artifact.h"
 #include "../src/ElfFile.h"
 #include "catch.hpp"
 
@@ -29,3 +32,149 @@ TEST_CASE("Correctness of a Module object instance", "[Module] ")
     REQUIRE(myElf.getName() == newElfName);
     REQUIRE(myElf.getId() == elfId);
 }
+
+/**
+ *Micro-benchmark for the symbol name index. Adding a symbol looks up its name first,
+ *so with a linear getSymbol the time per symbol grows with the number of symbols.
+ *With the index it should stay flat as the count doubles.
+ *Hidden by default; run it with "./test_juicer [.benchmark]".
+ */
+TEST_CASE("ElfFile symbol insert and lookup scale with the number of symbols", "[Module][.benchmark]")
+{
+    std::string elfName{"ABC"};
+    std::string artifactPath{"benchmark.h"};
+
+    for (uint32_t symbolCount : {25000u, 50000u, 100000u})
+    {
+        ElfFile  myElf{elfName};
+        Artifact newArtifact{myElf, artifactPath};
+
+        auto     start = std::chrono::steady_clock::now();
+
+        for (uint32_t i = 0; i < symbolCount; i++)
+        {
+            std::string symbolName{"Symbol_" + std::to_string(i)};
+            myElf.addSymbol(symbolName, 4, newArtifact);
+        }
+
+        for (uint32_t i = 0; i < symbolCount; i++)
+        {
+            std::string symbolName{"Symbol_" + std::to_string(i)};
+            REQUIRE(myElf.getSymbol(symbolName) != nullptr);
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        REQUIRE(myElf.getSymbols().size() == symbolCount);
+
+        WARN(symbolCount << " symbols: " << elapsed / symbolCount << " ns per insert and lookup");
+    }
+}
+
+TEST_CASE("ElfFile field and enumeration views walk every symbol in order", "[Module]")
+{
+    std::string elfName{"ABC"};
+    ElfFile     elf{elfName};
+    Artifact    artifact{elf, "/tmp/a.c"};
+    std::string emptyName{"Empty"};
+    std::string alsoEmptyName{"AlsoEmpty"};
+    std::string firstName{"First"};
+    std::string secondName{"Second"};
+    std::string a{"a"};
+    std::string b{"b"};
+    std::string c{"c"};
+
+    elf.addSymbol(emptyName, 0, artifact);
+    Symbol *first = elf.addSymbol(firstName, 8, artifact);
+    elf.addSymbol(alsoEmptyName, 0, artifact);
+    Symbol *second = elf.addSymbol(secondName, 4, artifact);
+
+    REQUIRE(elf.getFields().size() == 0);
+    REQUIRE(elf.getFields().begin() == elf.getFields().end());
+
+    first->addField(a, 0, *first, true);
+    first->addField(b, 4, *first, true);
+    second->addField(c, 0, *second, true);
+    second->addEnumeration(a, 1);
+
+    std::vector<std::string> fieldNames{};
+
+    for (auto field : elf.getFields())
+    {
+        fieldNames.push_back(field->getName());
+    }
+
+    REQUIRE(fieldNames == std::vector<std::string>{"a", "b", "c"});
+    REQUIRE(elf.getFields().size() == 3);
+    REQUIRE(elf.getEnumerations().size() == 1);
+    REQUIRE((*elf.getEnumerations().begin())->getSymbol().getName() == secondName);
+}
+
+TEST_CASE("ElfFile keeps each define macro once, in the order first added", "[Module]")
+{
+    std::string elfName{"ABC"};
+    ElfFile     elf{elfName};
+
+    REQUIRE(elf.addDefineMacro(DefineMacro{"MAC1", "2"}) == true);
+    REQUIRE(elf.addDefineMacro(DefineMacro{"MAC2", "3"}) == true);
+    REQUIRE(elf.addDefineMacro(DefineMacro{"MAC1", "2"}) == false);
+    /* A redefinition with another value is a different macro. */
+    REQUIRE(elf.addDefineMacro(DefineMacro{"MAC1", "4"}) == true);
+
+    REQUIRE(elf.getDefineMacros().size() == 3);
+    REQUIRE(elf.getDefineMacros().at(0).getName() == "MAC1");
+    REQUIRE(elf.getDefineMacros().at(1).getName() == "MAC2");
+    REQUIRE(elf.getDefineMacros().at(2).getValue() == "4");
+}
+
+TEST_CASE("Merging partial elfs maps their symbols onto the elf's own", "[Module]")
+{
+    std::string elfName{"merged_elf"};
+    std::string otherName{"other_elf"};
+    std::string structName{"CFE_ES_HousekeepingTlm_t"};
+    std::string baseName{"uint32"};
+    std::string aliasName{"CFE_ES_Count_t"};
+    std::string missingName{"CFE_ES_Missing_t"};
+    ElfFile     elf{elfName};
+    ElfFile     firstPartial{elfName};
+    ElfFile     secondPartial{elfName};
+    ElfFile     other{otherName};
+    Artifact    firstArtifact{firstPartial, "/tmp/a.c"};
+    Artifact    secondArtifact{secondPartial, "/tmp/b.c"};
+    Artifact    otherArtifact{other, "/tmp/c.c"};
+
+    /* The type of the struct's field comes after the struct. The type of its other field is in neither partial. */
+    Symbol     *firstStruct = firstPartial.addSymbol(structName, 8, firstArtifact);
+    Symbol     *firstBase   = firstPartial.addSymbol(baseName, 4, firstArtifact);
+    Symbol     *missing     = other.addSymbol(missingName, 4, otherArtifact);
+    firstStruct->addField("Count", 0, *firstBase, true);
+    firstStruct->addField("Lost", 4, *missing, true);
+
+    /* A later partial has its own copy of the base type, and a typedef of it that comes first. */
+    Symbol *alias      = secondPartial.addSymbol(aliasName, 4, secondArtifact);
+    Symbol *secondBase = secondPartial.addSymbol(baseName, 4, secondArtifact);
+    alias->setTargetSymbol(secondBase);
+
+    elf.merge(firstPartial);
+    elf.merge(secondPartial);
+
+    Symbol *mergedStruct = elf.getSymbol(structName);
+    Symbol *mergedBase   = elf.getSymbol(baseName);
+    Symbol *mergedAlias  = elf.getSymbol(aliasName);
+
+    REQUIRE(elf.getSymbols().size() == 3);
+    REQUIRE(mergedStruct != nullptr);
+    REQUIRE(mergedBase != nullptr);
+    REQUIRE(mergedAlias != nullptr);
+    REQUIRE(mergedBase != firstBase);
+    REQUIRE(elf.getSymbol(missingName) == nullptr);
+
+    REQUIRE(mergedStruct->getFields().size() == 1);
+    REQUIRE(mergedStruct->getFields().front()->getName() == "Count");
+    REQUIRE(&mergedStruct->getFields().front()->getType() == mergedBase);
+    REQUIRE(mergedStruct->getField("Lost") == nullptr);
+
+    REQUIRE(mergedAlias->getTargetSymbol() == mergedBase);
+    REQUIRE(&mergedAlias->getElf() == &elf);
+    REQUIRE(mergedAlias->getArtifact().getFilePath() == "/tmp/b.c");
+}
@@ -0,0 +1,61 @@
+/*
+ * TestFileChecksum.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <stdio.h>
+
+#include <fstream>
+
+#include "../src/FileChecksum.h"
+#include "catch.hpp"
+
+TEST_CASE("XXH64 matches the reference test vectors", "[FileChecksum]")
+{
+    std::string empty{};
+    std::string abc{"abc"};
+    std::string longer{"Nobody inspects the spammish repetition"};
+
+    REQUIRE(FileChecksum::xxh64((const uint8_t *)empty.c_str(), empty.size(), 0) == 0xEF46DB3751D8E999ULL);
+    REQUIRE(FileChecksum::xxh64((const uint8_t *)abc.c_str(), abc.size(), 0) == 0x44BC2CF5AD770999ULL);
+    REQUIRE(FileChecksum::xxh64((const uint8_t *)longer.c_str(), longer.size(), 0) == 0xFBCEA83C8A378BF1ULL);
+}
+
+TEST_CASE("File checksums with every algorithm", "[FileChecksum]")
+{
+    std::string filePath{"file_checksum_test.txt"};
+    std::string emptyFilePath{"file_checksum_empty_test.txt"};
+
+    std::ofstream{filePath} << "Nobody inspects the spammish repetition";
+    std::ofstream{emptyFilePath};
+
+    REQUIRE(FileChecksum::compute(filePath, FileChecksum::ALGORITHM_MD5) == "bb649c83dd1ea5c9d9dec9a18df0ffe9");
+    REQUIRE(FileChecksum::compute(filePath, FileChecksum::ALGORITHM_XXH64) == "fbcea83c8a378bf1");
+    REQUIRE(FileChecksum::compute(emptyFilePath, FileChecksum::ALGORITHM_MD5) == "d41d8cd98f00b204e9800998ecf8427e");
+    REQUIRE(FileChecksum::compute(emptyFilePath, FileChecksum::ALGORITHM_XXH64) == "ef46db3751d8e999");
+    REQUIRE(FileChecksum::compute("does_not_exist.txt", FileChecksum::ALGORITHM_MD5).empty());
+
+    REQUIRE(remove(filePath.c_str()) == 0);
+    REQUIRE(remove(emptyFilePath.c_str()) == 0);
+}
+
+TEST_CASE("Checksums of data in memory match those of the same file", "[FileChecksum]")
+{
+    std::string contents{"Nobody inspects the spammish repetition"};
+    auto        data = (const uint8_t *)contents.c_str();
+
+    REQUIRE(FileChecksum::compute(data, contents.size(), FileChecksum::ALGORITHM_MD5) == "bb649c83dd1ea5c9d9dec9a18df0ffe9");
+    REQUIRE(FileChecksum::compute(data, contents.size(), FileChecksum::ALGORITHM_XXH64) == "fbcea83c8a378bf1");
+}
+
+TEST_CASE("Checksum algorithm names round trip", "[FileChecksum]")
+{
+    FileChecksum::Algorithm algorithm = FileChecksum::ALGORITHM_MD5;
+
+    REQUIRE(FileChecksum::getAlgorithmFromName("xxh64", algorithm) == true);
+    REQUIRE(algorithm == FileChecksum::ALGORITHM_XXH64);
+    REQUIRE(std::string{FileChecksum::getAlgorithmName(algorithm)} == "xxh64");
+    REQUIRE(FileChecksum::getAlgorithmFromName("sha1", algorithm) == false);
+    REQUIRE(algorithm == FileChecksum::ALGORITHM_XXH64);
+}
@@ -0,0 +1,96 @@
+/*
+ * TestInternedString.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <thread>
+#include <vector>
+
+#include "../src/InternedString.h"
+#include "catch.hpp"
+
+TEST_CASE("Interned strings are equal exactly when their values are", "[InternedString]")
+{
+    std::string    typeName{"CFE_SB_MsgId_t"};
+    InternedString first{typeName};
+    InternedString second{"CFE_SB_MsgId_t"};
+    InternedString other{"CFE_SB_Qos_t"};
+
+    REQUIRE(first == second);
+    REQUIRE(first != other);
+    REQUIRE(&first.str() == &second.str());
+    REQUIRE(first.str() == typeName);
+    REQUIRE(InternedString{}.str().empty());
+    REQUIRE(InternedString{} == InternedString{""});
+}
+
+TEST_CASE("Interned strings store each value once", "[InternedString]")
+{
+    InternedString first{"/cfe/fsw/cfe-core/src/inc/cfe_sb.h"};
+    size_t         poolSize  = InternedString::getPoolSize();
+    size_t         poolBytes = InternedString::getPoolBytes();
+
+    for (int i = 0; i < 100; i++)
+    {
+        InternedString again{"/cfe/fsw/cfe-core/src/inc/cfe_sb.h"};
+        REQUIRE(again == first);
+    }
+
+    REQUIRE(InternedString::getPoolSize() == poolSize);
+    REQUIRE(InternedString::getPoolBytes() == poolBytes);
+}
+
+TEST_CASE("Finding a string does not intern it", "[InternedString]")
+{
+    InternedString found{};
+    size_t         poolSize = InternedString::getPoolSize();
+
+    REQUIRE(InternedString::find("never_interned_name", found) == false);
+    REQUIRE(InternedString::getPoolSize() == poolSize);
+
+    InternedString interned{"never_interned_name"};
+
+    REQUIRE(InternedString::find("never_interned_name", found) == true);
+    REQUIRE(found == interned);
+}
+
+TEST_CASE("Threads interning the same strings get the same handles", "[InternedString]")
+{
+    const int                                threadCount = 4;
+    const int                                nameCount   = 1000;
+    std::vector<std::vector<InternedString>> handles(threadCount);
+    std::vector<std::thread>                 threads{};
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < nameCount; i++)
+            {
+                handles[t].emplace_back("Field_" + std::to_string(i));
+            }
+        });
+    }
+
+    for (auto &&thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int t = 1; t < threadCount; t++)
+    {
+        REQUIRE(handles[t] == handles[0]);
+    }
+
+    /* Interning them again only looks them up. */
+    size_t poolSize  = InternedString::getPoolSize();
+    size_t poolBytes = InternedString::getPoolBytes();
+
+    for (int i = 0; i < nameCount; i++)
+    {
+        REQUIRE(InternedString{"Field_" + std::to_string(i)} == handles[0][i]);
+    }
+
+    REQUIRE(InternedString::getPoolSize() == poolSize);
+    REQUIRE(InternedString::getPoolBytes() == poolBytes);
+}
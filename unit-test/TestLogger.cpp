@@ -4,3 +4,191 @@
  *  Created on: Aug 21, 2020
  *      Author: vagrant
  */
+
+#include <stdio.h>
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Logger.h"
+#include "catch.hpp"
+
+TEST_CASE("Disabled log levels skip formatting and arguments", "[Logger]")
+{
+    Logger      logger{LOGGER_VERBOSITY_ERRORS};
+    int         evaluated = 0;
+    std::string name{"CFE_ES_HousekeepingTlm_t"};
+
+    auto        getName = [&]() {
+        evaluated++;
+        return name.c_str();
+    };
+
+    REQUIRE(logger.isEnabled(LOGGER_EVENT_ERROR));
+    REQUIRE(!logger.isEnabled(LOGGER_EVENT_WARNING));
+    REQUIRE(!logger.isEnabled(LOGGER_EVENT_DEBUG));
+
+    JUICER_LOG_DEBUG(logger, "Symbol %s created.", getName());
+    JUICER_LOG_INFO(logger, "Symbol %s created.", getName());
+
+    REQUIRE(evaluated == 0);
+
+    Logger verbose{LOGGER_VERBOSITY_DEBUG};
+
+    JUICER_LOG_DEBUG(verbose, "Symbol %s created.", getName());
+
+    REQUIRE(evaluated == (JUICER_LOG_LEVEL >= LOGGER_EVENT_DEBUG ? 1 : 0));
+}
+
+/**
+ *@brief Times debug messages at the default verbosity (errors only), which is what
+ *every per-DIE and per-symbol message costs on a normal run. Run with "[benchmark]".
+ */
+TEST_CASE("Cost of disabled debug messages", "[.][benchmark]")
+{
+    const int   count = 1000000;
+    Logger      logger{LOGGER_VERBOSITY_ERRORS};
+    std::string name{"CFE_ES_HousekeepingTlm_t"};
+
+    auto        start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < count; i++)
+    {
+        logger.logDebug("Symbol %s::%s (%u bytes) created.", name.c_str(), name.c_str(), i);
+    }
+
+    auto direct = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start       = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < count; i++)
+    {
+        JUICER_LOG_DEBUG(logger, "Symbol %s::%s (%u bytes) created.", name.c_str(), name.c_str(), i);
+    }
+
+    auto gated = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    WARN("logDebug: " << (double)direct / count << " ns/call, JUICER_LOG_DEBUG: " << (double)gated / count << " ns/call");
+
+    Logger restore{LOGGER_VERBOSITY_DEBUG};
+}
+
+TEST_CASE("Log file keeps the order of messages from several threads", "[Logger]")
+{
+    const int   threadCount  = 4;
+    const int   messageCount = 1000;
+    std::string logPath{"logger_test.log"};
+    std::string contents{};
+
+    {
+        Logger                   logger{LOGGER_VERBOSITY_DEBUG};
+        std::vector<std::thread> threads{};
+
+        REQUIRE(logger.setLogFile(logPath.c_str()));
+
+        for (int t = 0; t < threadCount; t++)
+        {
+            threads.push_back(std::thread([&logger, t, messageCount] {
+                for (int i = 0; i < messageCount; i++)
+                {
+                    logger.logDebug("thread %d message %d", t, i);
+                }
+            }));
+        }
+
+        for (auto &&thread : threads)
+        {
+            thread.join();
+        }
+
+        logger.logError("last message");
+
+        /* Errors are on disk before logError returns, even with the file still open. */
+        std::ifstream     logFile{logPath};
+        std::stringstream buffer;
+        buffer << logFile.rdbuf();
+        contents = buffer.str();
+
+        REQUIRE(contents.find("ERROR:   last message\n") != std::string::npos);
+
+        logger.closeLogFile();
+    }
+
+    std::istringstream lines{contents};
+    std::string        line{};
+    std::string        lastLine{};
+    std::vector<int>   nextMessage(threadCount, 0);
+    int                messages = 0;
+
+    while (std::getline(lines, line))
+    {
+        int t = 0;
+        int i = 0;
+
+        if (sscanf(line.c_str(), "DEBUG:   thread %d message %d", &t, &i) == 2)
+        {
+            REQUIRE(i == nextMessage.at(t));
+            nextMessage.at(t)++;
+            messages++;
+        }
+
+        lastLine = line;
+    }
+
+    REQUIRE(messages == threadCount * messageCount);
+    REQUIRE(lastLine == "ERROR:   last message");
+
+    remove(logPath.c_str());
+}
+
+TEST_CASE("JSON Lines records carry the event code, context and arguments", "[Logger]")
+{
+    std::string logPath{"logger_test.jsonl"};
+    Logger      logger{LOGGER_VERBOSITY_DEBUG};
+
+    logger.setLogFormat(LOGGER_FORMAT_JSONL);
+    REQUIRE(logger.setLogFile(logPath.c_str()));
+
+    Logger::setContextCU(3);
+    Logger::setContextDIE(1234);
+    Logger::setContextSymbol("Shape");
+
+    for (int i = 0; i < 2; i++)
+    {
+        logger.logWarning("Union member %s of \"%s\" at %u is not supported (%.2f%%).", "u", "Shape", 7u, 1.5);
+    }
+
+    Logger::clearContext();
+    logger.logError("Error in dwarf_tag , level %d.  errno=%lu", -1, 22ul);
+
+    logger.closeLogFile();
+    logger.setLogFormat(LOGGER_FORMAT_TEXT);
+
+    std::ifstream            logFile{logPath};
+    std::vector<std::string> lines{};
+    std::string              line{};
+
+    while (std::getline(logFile, line))
+    {
+        lines.push_back(line);
+    }
+
+    REQUIRE(lines.size() == 6);
+    REQUIRE(lines.at(0) == "{\"level\":\"debug\",\"message\":\"Opened log file.\"}");
+
+    std::string event = lines.at(1).substr(10, 8);
+
+    REQUIRE(lines.at(1) == "{\"event\":\"" + event + "\",\"format\":\"Union member %s of \\\"%s\\\" at %u is not supported (%.2f%%).\"}");
+    REQUIRE(lines.at(2) == "{\"level\":\"warning\",\"event\":\"" + event + "\",\"cu\":3,\"die\":1234,\"symbol\":\"Shape\",\"args\":[\"u\",\"Shape\",7,1.5]}");
+    REQUIRE(lines.at(3) == lines.at(2));
+    REQUIRE(lines.at(4).find("\"format\":\"Error in dwarf_tag , level %d.  errno=%lu\"") != std::string::npos);
+    REQUIRE(lines.at(5).find("\"level\":\"error\"") == 1);
+    REQUIRE(lines.at(5).find("\"args\":[-1,22]}") != std::string::npos);
+    REQUIRE(lines.at(5).find("\"cu\"") == std::string::npos);
+
+    remove(logPath.c_str());
+}
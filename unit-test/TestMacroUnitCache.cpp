@@ -0,0 +1,31 @@
+/*
+ * TestMacroUnitCache.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "../src/MacroUnitCache.h"
+#include "catch.hpp"
+
+TEST_CASE("Macro unit cache returns the macros decoded for an offset", "[MacroUnitCache]")
+{
+    MacroUnitCache cache{};
+
+    REQUIRE(cache.lookup(0x40) == nullptr);
+    REQUIRE(cache.getMisses() == 1);
+
+    const std::vector<DefineMacro> &inserted = cache.insert(0x40, std::vector<DefineMacro>{DefineMacro{"CFE_MISSION_ES_PERF_MAX_IDS", "128"}});
+
+    REQUIRE(cache.lookup(0x40) == &inserted);
+    REQUIRE(cache.getHits() == 1);
+    REQUIRE(inserted.size() == 1);
+    REQUIRE(inserted.at(0).getValue() == "128");
+
+    /* A unit decoded twice by two workers keeps the macros of the first. */
+    REQUIRE(&cache.insert(0x40, std::vector<DefineMacro>{}) == &inserted);
+    REQUIRE(inserted.size() == 1);
+
+    cache.clear();
+
+    REQUIRE(cache.lookup(0x40) == nullptr);
+}
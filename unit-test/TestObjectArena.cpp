@@ -0,0 +1,149 @@
+/*
+ * TestObjectArena.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <stdint.h>
+#include <sys/resource.h>
+
+#include <chrono>
+
+#include "../src/ElfFile.h"
+#include "../src/ObjectArena.h"
+#include "Enumeration.h"
+#include "Field.h"
+#include "catch.hpp"
+
+namespace
+{
+struct Counted
+{
+    Counted(int &inDestroyed, std::vector<int> &inOrder, int inTag) : destroyed{inDestroyed}, order{inOrder}, tag{inTag} {}
+    ~Counted()
+    {
+        destroyed++;
+        order.push_back(tag);
+    }
+
+    int              &destroyed;
+    std::vector<int> &order;
+    int               tag;
+};
+}  // namespace
+
+TEST_CASE("Arena allocations are aligned and do not move", "[ObjectArena]")
+{
+    ObjectArena             arena{256};
+    std::vector<uint64_t *> values{};
+
+    for (uint64_t i = 0; i < 1000; i++)
+    {
+        /* Throw off the cursor so every uint64_t needs realigning. */
+        arena.allocate(1, 1);
+        values.push_back(arena.create<uint64_t>(i));
+    }
+
+    for (uint64_t i = 0; i < values.size(); i++)
+    {
+        REQUIRE(reinterpret_cast<uintptr_t>(values[i]) % alignof(uint64_t) == 0);
+        REQUIRE(*values[i] == i);
+    }
+
+    REQUIRE(arena.getBlockCount() > 1);
+}
+
+TEST_CASE("Arena allocations larger than a block get a block of their own", "[ObjectArena]")
+{
+    ObjectArena arena{64};
+    char       *small = static_cast<char *>(arena.allocate(16, 1));
+    char       *large = static_cast<char *>(arena.allocate(1000, 8));
+
+    std::fill(large, large + 1000, 'x');
+
+    REQUIRE(small != nullptr);
+    REQUIRE(large != nullptr);
+    REQUIRE(arena.getBytesUsed() >= 1016);
+}
+
+TEST_CASE("Arena runs destructors newest first when it is destroyed", "[ObjectArena]")
+{
+    int              destroyed = 0;
+    std::vector<int> order{};
+
+    {
+        ObjectArena arena{};
+
+        arena.create<Counted>(destroyed, order, 1);
+        arena.create<Counted>(destroyed, order, 2);
+        arena.create<Counted>(destroyed, order, 3);
+
+        REQUIRE(destroyed == 0);
+    }
+
+    REQUIRE(destroyed == 3);
+    REQUIRE(order == std::vector<int>{3, 2, 1});
+}
+
+TEST_CASE("Symbols, fields and enumerations of an elf live in its arena", "[ObjectArena]")
+{
+    std::string elfName{"ABC"};
+    std::string symbolName{"CFE_ES_HousekeepingTlm_t"};
+    std::string fieldName{"Count"};
+    std::string enumerationName{"ONE"};
+    ElfFile     elf{elfName};
+    Artifact    artifact{elf, "/tmp/a.c"};
+
+    Symbol     *symbol    = elf.addSymbol(symbolName, 8, artifact);
+    size_t      usedBytes = elf.getArena().getBytesUsed();
+
+    symbol->addField(fieldName, 0, *symbol, true);
+    symbol->addEnumeration(enumerationName, 1);
+
+    REQUIRE(elf.getArena().getBytesUsed() >= usedBytes + sizeof(Field) + sizeof(Enumeration));
+    REQUIRE(elf.getSymbols().front() == symbol);
+    REQUIRE(symbol->getFields().front()->getName() == fieldName);
+    REQUIRE(symbol->getEnumerations().front()->getName() == enumerationName);
+}
+
+/**
+ *@brief Builds and destroys an elf about the size of a cFS build. Peak RSS only means
+ *something when this is the only test in the run. Run with "[benchmark]".
+ */
+TEST_CASE("Cost of building and destroying the symbol graph", "[.][benchmark]")
+{
+    const int symbolCount = 20000;
+    const int fieldCount  = 12;
+    Logger    quiet{LOGGER_VERBOSITY_ERRORS};
+    auto      start       = std::chrono::steady_clock::now();
+
+    {
+        std::string elfName{"ABC"};
+        ElfFile     elf{elfName};
+        Artifact    artifact{elf, "/tmp/a.c"};
+
+        for (int i = 0; i < symbolCount; i++)
+        {
+            std::string symbolName = "Symbol_" + std::to_string(i);
+            Symbol     *symbol     = elf.addSymbol(symbolName, fieldCount * 4, artifact);
+
+            for (int j = 0; j < fieldCount; j++)
+            {
+                std::string fieldName = "Field_" + std::to_string(j);
+                symbol->addField(fieldName, j * 4, *symbol, true);
+            }
+
+            std::string enumerationName{"VALUE"};
+            symbol->addEnumeration(enumerationName, i);
+        }
+    }
+
+    auto          elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    struct rusage usage{};
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    WARN(symbolCount << " symbols with " << fieldCount << " fields each: " << elapsed << " ms, peak RSS " << usage.ru_maxrss << " KiB");
+
+    Logger restore{LOGGER_VERBOSITY_DEBUG};
+}
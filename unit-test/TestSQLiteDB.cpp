@@ -0,0 +1,413 @@
+/*
+ * TestSQLiteDB.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <stdio.h>
+#include <sys/stat.h>
+
+#include "../src/ElfFile.h"
+#include "../src/Field.h"
+#include "../src/SQLiteDB.h"
+#include "catch.hpp"
+
+static bool fileExists(const std::string &filePath)
+{
+    struct stat fileStat;
+    return stat(filePath.c_str(), &fileStat) == 0;
+}
+
+TEST_CASE("A database built in memory is only written to its file when closed", "[SQLiteDB]")
+{
+    std::string     dbPath{"in_memory_test.sqlite"};
+    std::string     firstName{"first_elf"};
+    std::string     secondName{"second_elf"};
+    ElfFile         firstElf{firstName};
+    ElfFile         secondElf{secondName};
+
+    remove(dbPath.c_str());
+
+    firstElf.setMD5("abc");
+    firstElf.setChecksumAlgorithm("md5");
+    secondElf.setMD5("def");
+    secondElf.setChecksumAlgorithm("md5");
+
+    IDataContainer *idc = IDataContainer::Create(IDC_TYPE_SQLITE_IN_MEMORY, dbPath.c_str());
+
+    REQUIRE(idc != nullptr);
+    REQUIRE(idc->write(firstElf) == SQLITEDB_OK);
+    REQUIRE(fileExists(dbPath) == false);
+    REQUIRE(idc->close() == SQLITEDB_OK);
+    REQUIRE(fileExists(dbPath) == true);
+
+    delete idc;
+
+    /* The existing file is loaded, so a second run appends to it. */
+    idc = IDataContainer::Create(IDC_TYPE_SQLITE_IN_MEMORY, dbPath.c_str());
+
+    REQUIRE(idc != nullptr);
+    REQUIRE(idc->hasElf(firstElf.getName(), "abc", "md5") == true);
+    REQUIRE(idc->write(secondElf) == SQLITEDB_OK);
+    REQUIRE(idc->close() == SQLITEDB_OK);
+
+    delete idc;
+
+    idc = IDataContainer::Create(IDC_TYPE_SQLITE, dbPath.c_str());
+
+    REQUIRE(idc != nullptr);
+    REQUIRE(idc->hasElf(firstElf.getName(), "abc", "md5") == true);
+    REQUIRE(idc->hasElf(secondElf.getName(), "def", "md5") == true);
+    REQUIRE(idc->close() == SQLITEDB_OK);
+
+    delete idc;
+
+    REQUIRE(remove(dbPath.c_str()) == 0);
+
+    /* Only the container type builds in memory. A file name is used as it is, whatever it ends with. */
+    std::string oddPath{"in_memory_test.sqlite?build=memory"};
+
+    remove(oddPath.c_str());
+
+    idc = IDataContainer::Create(IDC_TYPE_SQLITE, oddPath.c_str());
+
+    REQUIRE(idc != nullptr);
+    REQUIRE(idc->write(firstElf) == SQLITEDB_OK);
+    REQUIRE(fileExists(oddPath) == true);
+    REQUIRE(fileExists(dbPath) == false);
+    REQUIRE(idc->close() == SQLITEDB_OK);
+
+    delete idc;
+
+    REQUIRE(remove(oddPath.c_str()) == 0);
+}
+
+static int countRows(const std::string &dbPath, const char *sql)
+{
+    sqlite3      *database = nullptr;
+    sqlite3_stmt *stmt     = nullptr;
+    int           count    = -1;
+
+    if (sqlite3_open(dbPath.c_str(), &database) == SQLITE_OK && sqlite3_prepare_v2(database, sql, -1, &stmt, nullptr) == SQLITE_OK &&
+        sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        count = sqlite3_column_int(stmt, 0);
+    }
+
+    sqlite3_finalize(stmt);
+    sqlite3_close(database);
+
+    return count;
+}
+
+/**
+ * The schema of the databases juicer wrote before the elfs and artifacts tables had a
+ * checksum_algorithm column.
+ */
+static const char *BASELINE_SCHEMA =
+    "CREATE TABLE elfs (id INTEGER PRIMARY KEY, name TEXT UNIQUE NOT NULL, md5 TEXT NOT NULL,"
+    " date DATETIME NOT NULL DEFAULT(CURRENT_TIMESTAMP), little_endian BOOLEAN NOT NULL);"
+    "CREATE TABLE symbols(id INTEGER PRIMARY KEY, elf INTEGER NOT NULL, name TEXT UNIQUE NOT NULL, byte_size INTEGER NOT NULL,"
+    " artifact INTEGER, target_symbol INTEGER, encoding INTEGER, short_description TEXT, long_description TEXT, UNIQUE(name));"
+    "CREATE TABLE dimension_lists (id INTEGER PRIMARY KEY, field_id INTEGER NOT NULL, dim_order INTEGER NOT NULL,"
+    " upper_bound INTEGER NOT NULL, UNIQUE(field_id, dim_order, upper_bound));"
+    "CREATE TABLE fields(id INTEGER PRIMARY KEY, symbol INTEGER NOT NULL, name TEXT NOT NULL, byte_offset INTEGER NOT NULL,"
+    " type INTEGER NOT NULL, little_endian BOOLEAN, bit_size INTEGER NOT NULL, bit_offset INTEGER NOT NULL,"
+    " short_description TEXT, long_description TEXT, UNIQUE (symbol, name));"
+    "CREATE TABLE enumerations(id INTEGER PRIMARY KEY, symbol INTEGER NOT NULL, value INTEGER NOT NULL, name TEXT NOT NULL,"
+    " short_description TEXT, long_description TEXT, UNIQUE (symbol, name));"
+    "CREATE TABLE artifacts(id INTEGER PRIMARY KEY, elf INTEGER NOT NULL, path TEXT NOT NULL, md5 TEXT NOT NULL, UNIQUE (path, md5));"
+    "CREATE TABLE macros(id INTEGER PRIMARY KEY, name TEXT NOT NULL, value TEXT NOT NULL, module_id INTEGER, source INTEGER,"
+    " short_description TEXT, long_description TEXT, UNIQUE (name, value));"
+    "CREATE TABLE elf_sections(id INTEGER PRIMARY KEY, name INETEGER NOT NULL, elf INETEGER NOT NULL, type INTEGER NOT NULL,"
+    " flags INTEGER NOT NULL, address INTEGER NOT NULL, file_offset INTEGER NOT NULL, size INTEGER NOT NULL, link INTEGER NOT NULL,"
+    " info INTEGER NOT NULL, address_alignment INTEGER NOT NULL, entry_size INTEGER NOT NULL);"
+    "CREATE TABLE elf_symbol_table(id INTEGER PRIMARY KEY, name INETEGER NOT NULL, elf INETEGER NOT NULL, value INTEGER NOT NULL,"
+    " size INTEGER NOT NULL, info INTEGER NOT NULL, other INTEGER NOT NULL, section_index INTEGER NOT NULL,"
+    " file_offset INTEGER NOT NULL, string_table_file_offset INTEGER NOT NULL);"
+    "CREATE TABLE variables(id INTEGER PRIMARY KEY, name TEXT NOT NULL, elf INETEGER NOT NULL, type INTEGER NOT NULL,"
+    " short_description TEXT, long_description TEXT, UNIQUE (name, type, elf));"
+    "CREATE TABLE encodings(id INTEGER PRIMARY KEY, encoding TEXT NOT NULL, UNIQUE (encoding));";
+
+TEST_CASE("Elfs can be written into a database created by an older juicer", "[SQLiteDB]")
+{
+    std::string dbPath{"baseline_schema_test.sqlite"};
+    std::string elfName{"baseline_elf"};
+    std::string symbolName{"CFE_ES_HousekeepingTlm_t"};
+    std::string fieldName{"Count"};
+    ElfFile     elf{elfName};
+    Artifact    artifact{elf, "/tmp/a.c"};
+    sqlite3    *database = nullptr;
+
+    remove(dbPath.c_str());
+
+    REQUIRE(sqlite3_open(dbPath.c_str(), &database) == SQLITE_OK);
+    REQUIRE(sqlite3_exec(database, BASELINE_SCHEMA, nullptr, nullptr, nullptr) == SQLITE_OK);
+    REQUIRE(sqlite3_exec(database, "INSERT INTO elfs(name, md5, little_endian) VALUES('old_elf', 'abc', 1);", nullptr, nullptr, nullptr) == SQLITE_OK);
+    sqlite3_close(database);
+
+    elf.setMD5("def");
+    elf.setChecksumAlgorithm("md5");
+
+    Symbol *symbol = elf.addSymbol(symbolName, 4, artifact);
+    symbol->addField(fieldName, 0, *symbol, true);
+
+    IDataContainer *idc = IDataContainer::Create(IDC_TYPE_SQLITE, dbPath.c_str());
+
+    REQUIRE(idc != nullptr);
+    REQUIRE(idc->hasElf("old_elf", "abc", "md5") == true);
+    REQUIRE(idc->write(elf) == SQLITEDB_OK);
+    REQUIRE(idc->hasElf(elf.getName(), "def", "md5") == true);
+
+    /* Writing it again after it changed updates its row. */
+    elf.setMD5("123");
+
+    REQUIRE(idc->write(elf) == SQLITEDB_OK);
+    REQUIRE(idc->hasElf(elf.getName(), "123", "md5") == true);
+    REQUIRE(idc->close() == SQLITEDB_OK);
+
+    delete idc;
+
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM elfs WHERE checksum_algorithm = 'md5';") == 2);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM artifacts WHERE checksum_algorithm = 'md5';") == 1);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM fields;") == 1);
+
+    REQUIRE(remove(dbPath.c_str()) == 0);
+}
+
+TEST_CASE("The first write into a new database builds the unique indexes", "[SQLiteDB]")
+{
+    std::string dbPath{"bulk_load_test.sqlite"};
+    std::string firstName{"first_elf"};
+    std::string secondName{"second_elf"};
+    std::string symbolName{"CFE_ES_HousekeepingTlm_t"};
+    std::string fieldName{"Count"};
+    std::string otherFieldName{"Spare"};
+    std::string enumerationName{"ONE"};
+    std::string variableName{"CFE_ES_HkPacket"};
+    ElfFile     firstElf{firstName};
+    ElfFile     secondElf{secondName};
+    Artifact    firstArtifact{firstElf, "/tmp/a.c"};
+    Artifact    secondArtifact{secondElf, "/tmp/a.c"};
+
+    remove(dbPath.c_str());
+
+    firstElf.setMD5("abc");
+    firstElf.setChecksumAlgorithm("md5");
+    secondElf.setMD5("def");
+    secondElf.setChecksumAlgorithm("md5");
+
+    /**
+     * Rows that would fail to build the indexes if both were inserted. Symbol::addField skips names
+     * the symbol already has, but Juicer::addPaddingToStruct inserts its fields into the vector
+     * directly. Neither enumerations nor variables are deduplicated at all.
+     */
+    Symbol *firstSymbol = firstElf.addSymbol(symbolName, 8, firstArtifact);
+    firstSymbol->addField(fieldName, 0, *firstSymbol, true);
+    firstSymbol->getFields().push_back(firstElf.getArena().create<Field>(*firstSymbol, fieldName, 4, *firstSymbol, true));
+    firstSymbol->addEnumeration(enumerationName, 1);
+    firstSymbol->addEnumeration(enumerationName, 1);
+    firstElf.addVariable(Variable{variableName, *firstSymbol, firstElf});
+    firstElf.addVariable(Variable{variableName, *firstSymbol, firstElf});
+
+    /* The second elf has the same symbol with one new field. */
+    Symbol *secondSymbol = secondElf.addSymbol(symbolName, 8, secondArtifact);
+    secondSymbol->addField(fieldName, 0, *secondSymbol, true);
+    secondSymbol->addField(otherFieldName, 4, *secondSymbol, true);
+
+    IDataContainer *idc = IDataContainer::Create(IDC_TYPE_SQLITE, dbPath.c_str());
+
+    REQUIRE(idc != nullptr);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM sqlite_master WHERE type = 'index';") == 0);
+    REQUIRE(idc->write(firstElf) == SQLITEDB_OK);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM sqlite_master WHERE type = 'index' AND name = 'fields_symbol_name';") == 1);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM fields;") == 1);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM enumerations;") == 1);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM variables;") == 1);
+
+    REQUIRE(idc->write(secondElf) == SQLITEDB_OK);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM symbols;") == 1);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM fields;") == 2);
+    REQUIRE(countRows(dbPath, "SELECT MAX(id) FROM fields;") == 2);
+    REQUIRE(idc->close() == SQLITEDB_OK);
+
+    delete idc;
+
+    REQUIRE(remove(dbPath.c_str()) == 0);
+}
+
+TEST_CASE("Typedefs are written with their target symbol", "[SQLiteDB]")
+{
+    std::string dbPath{"target_symbol_test.sqlite"};
+    std::string elfName{"target_elf"};
+    std::string aliasName{"CFE_SB_MsgId_t"};
+    std::string baseName{"uint32"};
+    std::string loopName{"Loop_t"};
+    std::string otherLoopName{"OtherLoop_t"};
+    ElfFile     elf{elfName};
+    Artifact    artifact{elf, "/tmp/a.c"};
+
+    remove(dbPath.c_str());
+
+    elf.setMD5("abc");
+    elf.setChecksumAlgorithm("md5");
+
+    /* The typedef comes before the symbol it refers to. */
+    Symbol *alias     = elf.addSymbol(aliasName, 4, artifact);
+    Symbol *base      = elf.addSymbol(baseName, 4, artifact);
+    Symbol *loop      = elf.addSymbol(loopName, 4, artifact);
+    Symbol *otherLoop = elf.addSymbol(otherLoopName, 4, artifact);
+
+    alias->setTargetSymbol(base);
+    loop->setTargetSymbol(otherLoop);
+    otherLoop->setTargetSymbol(loop);
+
+    IDataContainer *idc = IDataContainer::Create(IDC_TYPE_SQLITE, dbPath.c_str());
+
+    REQUIRE(idc != nullptr);
+    REQUIRE(idc->write(elf) == SQLITEDB_OK);
+    REQUIRE(idc->close() == SQLITEDB_OK);
+
+    delete idc;
+
+    /* Ids are given out in the order of the symbols, right after the largest id in the table. */
+    REQUIRE(alias->getId() == 1);
+    REQUIRE(base->getId() == 2);
+    REQUIRE(countRows(dbPath, "SELECT id FROM symbols WHERE name = 'uint32';") == 2);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM symbols AS alias JOIN symbols AS base ON alias.target_symbol = base.id "
+                              "WHERE alias.name = 'CFE_SB_MsgId_t' AND base.name = 'uint32';") == 1);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM symbols AS loop JOIN symbols AS other ON loop.target_symbol = other.id "
+                              "WHERE other.target_symbol = loop.id;") == 2);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM symbols WHERE target_symbol IS NULL;") == 1);
+
+    REQUIRE(remove(dbPath.c_str()) == 0);
+}
+
+TEST_CASE("Symbols written while the elf is read end up in the database like one write", "[SQLiteDB]")
+{
+    std::string dbPath{"pipeline_test.sqlite"};
+    std::string elfName{"pipeline_elf"};
+    std::string failedElfName{"failed_elf"};
+    std::string structName{"CFE_ES_HousekeepingTlm_t"};
+    std::string baseName{"uint32"};
+    std::string aliasName{"CFE_ES_Count_t"};
+    std::string fieldName{"Count"};
+    std::string lateFieldName{"Spare"};
+    ElfFile     elf{elfName};
+    ElfFile     failedElf{failedElfName};
+    Artifact    artifact{elf, "/tmp/a.c"};
+    Artifact    failedArtifact{failedElf, "/tmp/b.c"};
+
+    remove(dbPath.c_str());
+
+    elf.setMD5("abc");
+    elf.setChecksumAlgorithm("md5");
+    failedElf.setMD5("def");
+    failedElf.setChecksumAlgorithm("md5");
+
+    IDataContainer *idc = IDataContainer::Create(IDC_TYPE_SQLITE, dbPath.c_str());
+
+    REQUIRE(idc != nullptr);
+    REQUIRE(idc->beginElf(elf) == SQLITEDB_OK);
+
+    Symbol *structSymbol = elf.addSymbol(structName, 8, artifact);
+    Symbol *base         = elf.addSymbol(baseName, 4, artifact);
+    structSymbol->addField(fieldName, 0, *base, true);
+
+    REQUIRE(idc->writeNewSymbols(elf) == SQLITEDB_OK);
+
+    /**
+     * A later CU adds a typedef, a field to the struct that was already handed over, and the
+     * encoding of the base type that was handed over without one.
+     */
+    Symbol *alias = elf.addSymbol(aliasName, 4, artifact);
+    alias->setTargetSymbol(base);
+    structSymbol->addField(lateFieldName, 4, *base, true);
+    base->setEncoding(DW_ATE_unsigned);
+
+    REQUIRE(idc->writeNewSymbols(elf) == SQLITEDB_OK);
+    REQUIRE(idc->endElf(elf, true) == SQLITEDB_OK);
+
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM symbols;") == 3);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM artifacts;") == 1);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM fields JOIN symbols ON fields.symbol = symbols.id "
+                              "WHERE symbols.name = 'CFE_ES_HousekeepingTlm_t';") == 2);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM symbols AS alias JOIN symbols AS base ON alias.target_symbol = base.id "
+                              "WHERE alias.name = 'CFE_ES_Count_t' AND base.name = 'uint32';") == 1);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM symbols JOIN encodings ON symbols.encoding = encodings.id "
+                              "WHERE symbols.name = 'uint32' AND encodings.encoding = 'DW_ATE_unsigned';") == 1);
+
+    /* An elf that fails to be read leaves nothing behind. */
+    REQUIRE(idc->beginElf(failedElf) == SQLITEDB_OK);
+
+    failedElf.addSymbol(structName, 8, failedArtifact);
+
+    REQUIRE(idc->writeNewSymbols(failedElf) == SQLITEDB_OK);
+    REQUIRE(idc->endElf(failedElf, false) == SQLITEDB_ERROR);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM elfs;") == 1);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM artifacts;") == 1);
+    REQUIRE(idc->close() == SQLITEDB_OK);
+
+    delete idc;
+
+    REQUIRE(remove(dbPath.c_str()) == 0);
+}
+
+TEST_CASE("Writing a changed elf again replaces the rows of its previous build", "[SQLiteDB]")
+{
+    std::string dbPath{"rewrite_elf_test.sqlite"};
+    std::string elfName{"rewritten_elf"};
+    std::string symbolName{"CFE_ES_HousekeepingTlm_t"};
+    ElfFile     firstBuild{elfName};
+    ElfFile     secondBuild{elfName};
+    Artifact    firstArtifact{firstBuild, "/tmp/a.c"};
+    Artifact    secondArtifact{secondBuild, "/tmp/a.c"};
+    Elf32_Shdr  sectionHeader{};
+    Elf32_Sym   elfSymbol{};
+
+    remove(dbPath.c_str());
+
+    firstBuild.setMD5("abc");
+    firstBuild.setChecksumAlgorithm("md5");
+    firstBuild.setElfClass(ELFCLASS32);
+    secondBuild.setMD5("def");
+    secondBuild.setChecksumAlgorithm("md5");
+    secondBuild.setElfClass(ELFCLASS32);
+
+    Symbol *firstSymbol = firstBuild.addSymbol(symbolName, 4, firstArtifact);
+    firstBuild.addVariable(Variable{"CFE_ES_HkPacket", *firstSymbol, firstBuild});
+    firstBuild.addVariable(Variable{"CFE_ES_OldPacket", *firstSymbol, firstBuild});
+    firstBuild.addElf32SectionHeader(sectionHeader);
+    firstBuild.addElf32SectionHeader(sectionHeader);
+    firstBuild.addElf32SymbolTableSymbol(Elf32Symbol{elfSymbol, 0, 0});
+    firstBuild.addElf32SymbolTableSymbol(Elf32Symbol{elfSymbol, 0, 0});
+
+    /* The second build dropped a variable. */
+    Symbol *secondSymbol = secondBuild.addSymbol(symbolName, 4, secondArtifact);
+    secondBuild.addVariable(Variable{"CFE_ES_HkPacket", *secondSymbol, secondBuild});
+    secondBuild.addElf32SectionHeader(sectionHeader);
+    secondBuild.addElf32SectionHeader(sectionHeader);
+    secondBuild.addElf32SymbolTableSymbol(Elf32Symbol{elfSymbol, 0, 0});
+    secondBuild.addElf32SymbolTableSymbol(Elf32Symbol{elfSymbol, 0, 0});
+
+    IDataContainer *idc = IDataContainer::Create(IDC_TYPE_SQLITE, dbPath.c_str());
+
+    REQUIRE(idc != nullptr);
+    REQUIRE(idc->write(firstBuild) == SQLITEDB_OK);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM variables;") == 2);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM elf_sections;") == 2);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM elf_symbol_table;") == 2);
+
+    REQUIRE(idc->write(secondBuild) == SQLITEDB_OK);
+    REQUIRE(secondBuild.getId() == firstBuild.getId());
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM elfs;") == 1);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM variables;") == 1);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM variables WHERE name = 'CFE_ES_OldPacket';") == 0);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM elf_sections;") == 2);
+    REQUIRE(countRows(dbPath, "SELECT COUNT(*) FROM elf_symbol_table;") == 2);
+    REQUIRE(idc->close() == SQLITEDB_OK);
+
+    delete idc;
+
+    REQUIRE(remove(dbPath.c_str()) == 0);
+}
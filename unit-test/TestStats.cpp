@@ -0,0 +1,43 @@
+/*
+ * TestStats.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <thread>
+
+#include "../src/Stats.h"
+#include "catch.hpp"
+
+TEST_CASE("Stats timers and counters", "[Stats]")
+{
+    Stats::reset();
+
+    {
+        Stats::Timer timer{STATS_PHASE_CU_WALK};
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    Stats::count(STATS_COUNTER_DIES);
+    Stats::count(STATS_COUNTER_BYTES_HASHED, 4096);
+
+    REQUIRE(Stats::getCalls(STATS_PHASE_CU_WALK) == 1);
+    REQUIRE(Stats::getTime(STATS_PHASE_CU_WALK) >= 1000000);
+    REQUIRE(Stats::getCalls(STATS_PHASE_DWARF_INIT) == 0);
+    REQUIRE(Stats::getCount(STATS_COUNTER_DIES) == 1);
+    REQUIRE(Stats::getCount(STATS_COUNTER_BYTES_HASHED) == 4096);
+
+    std::string json = Stats::toJSON();
+
+    REQUIRE(json.find("\"cu_walk\":{\"time_ns\":") != std::string::npos);
+    REQUIRE(json.find("\"bytes_hashed\":4096") != std::string::npos);
+
+    std::string table = Stats::toTable();
+
+    REQUIRE(table.find("cu_walk") != std::string::npos);
+    REQUIRE(table.find("dwarf_init") == std::string::npos);
+
+    Stats::reset();
+
+    REQUIRE(Stats::getCount(STATS_COUNTER_DIES) == 0);
+}
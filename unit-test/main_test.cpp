@@ -16,6 +16,7 @@
 #include "IDataContainer.h"
 #include "Juicer.h"
 #include "SQLiteDB.h"
+#include "Stats.h"
 #include "catch.hpp"
 #include "test_file1.h"
 
@@ -29,6 +30,9 @@
 
 #define TEST_FILE_4   "ut_obj/macro_test.o"
 
+/* test_file1.o and test_file2.o linked into one object, so it has a CU for each. */
+#define TEST_FILE_5   "ut_obj/test_files.o"
+
 // DO NOT rename this macro to something like SQLITE_NULL as that is a macro that exists in sqlite3
 #define TEST_NULL_STR "NULL"
 
@@ -210,6 +214,102 @@ static std::map<std::string, std::string> followTargetSymbol(sqlite3* database,
     return targetSymbolRecord;
 }
 
+/**
+ *Dump every table juicer fills from the DWARF, ids included, in the order the rows were written.
+ */
+static const char* dumpQueries[]    = {"SELECT * FROM artifacts ORDER BY id;",       "SELECT * FROM symbols ORDER BY id;",
+                                       "SELECT * FROM fields ORDER BY id;",          "SELECT * FROM enumerations ORDER BY id;",
+                                       "SELECT * FROM dimension_lists ORDER BY id;", "SELECT * FROM variables ORDER BY id;"};
+
+/**
+ *Read every table juicer fills from the DWARF by names instead of ids, so that databases
+ *written in different ways can be compared row by row.
+ */
+static const char* contentQueries[] = {
+    "SELECT s.name, s.byte_size, t.name, e.encoding FROM symbols AS s LEFT JOIN symbols AS t ON s.target_symbol = t.id "
+    "LEFT JOIN encodings AS e ON s.encoding = e.id ORDER BY s.name;",
+    "SELECT s.name, f.name, f.byte_offset, t.name, f.little_endian, f.bit_size, f.bit_offset FROM fields AS f "
+    "JOIN symbols AS s ON f.symbol = s.id JOIN symbols AS t ON f.type = t.id ORDER BY s.name, f.name;",
+    "SELECT s.name, e.name, e.value FROM enumerations AS e JOIN symbols AS s ON e.symbol = s.id ORDER BY s.name, e.name;",
+    "SELECT s.name, f.name, d.dim_order, d.upper_bound FROM dimension_lists AS d JOIN fields AS f ON d.field_id = f.id "
+    "JOIN symbols AS s ON f.symbol = s.id ORDER BY s.name, f.name, d.dim_order;",
+    "SELECT v.name, t.name FROM variables AS v JOIN symbols AS t ON v.type = t.id ORDER BY v.name, t.name;"};
+
+static std::vector<std::vector<std::string>> readRows(const char* dbPath, const char* sql)
+{
+    sqlite3*                              database = nullptr;
+    std::vector<std::vector<std::string>> rows{};
+
+    REQUIRE(sqlite3_open(dbPath, &database) == SQLITE_OK);
+    REQUIRE(sqlite3_exec(database, sql, selectVectorCallback, &rows, nullptr) == SQLITE_OK);
+
+    sqlite3_close(database);
+
+    return rows;
+}
+
+/**
+ *@brief Juices inputPath, with its extras, into a new database at dbPath. With pipeline,
+ *the symbols are written while the file is read, like the --pipeline option does.
+ */
+static void juiceTestFile(const char* inputPath, const char* dbPath, unsigned int jobs, bool pipeline)
+{
+    Juicer          juicer;
+    IDataContainer* idc = 0;
+    std::string     inputFile{inputPath};
+
+    remove(dbPath);
+
+    idc = IDataContainer::Create(IDC_TYPE_SQLITE, dbPath);
+    REQUIRE(idc != nullptr);
+
+    juicer.setIDC(idc);
+    juicer.setExtras(true);
+    juicer.setJobs(jobs);
+    juicer.setPipeline(pipeline);
+
+    REQUIRE(juicer.parse(inputFile) == JUICER_OK);
+    REQUIRE(idc->close() == SQLITEDB_OK);
+
+    delete idc;
+}
+
+/**
+ *@brief Checks that each of queries reads the same, non-empty, rows from both databases.
+ */
+template <size_t N>
+static void requireSameRows(const char* (&queries)[N], const char* firstDbPath, const char* secondDbPath)
+{
+    for (const char* sql : queries)
+    {
+        auto firstRows = readRows(firstDbPath, sql);
+
+        INFO(sql);
+        REQUIRE(firstRows.size() > 0);
+        REQUIRE(firstRows == readRows(secondDbPath, sql));
+    }
+}
+
+/**
+ *@brief A data container that keeps the initial data of the symbols of the last elf written to it.
+ */
+class InitialDataRecorder : public IDataContainer
+{
+   public:
+    InitialDataRecorder() {}
+
+    virtual int write(ElfFile& inModule)
+    {
+        initializedSymbolData = inModule.getInitializedSymbolData();
+        return JUICER_OK;
+    }
+
+    std::map<std::string, std::vector<uint8_t>> initializedSymbolData{};
+
+   protected:
+    virtual int initialize(std::string& initString) { return JUICER_OK; }
+};
+
 TEST_CASE("Test Juicer at the highest level with SQLiteDB", "[main_test#1]")
 {
     Juicer          juicer;
@@ -805,7 +905,9 @@ TEST_CASE(
         numberOfColumns++;
     }
 
-    REQUIRE(numberOfColumns == 5);
+    REQUIRE(numberOfColumns == 6);
+
+    REQUIRE(circleElftRecords.at(0)["checksum_algorithm"] == "md5");
 
     memset(&resolvedPath, '\0', PATH_MAX);
 
@@ -3155,12 +3257,13 @@ TEST_CASE("Test the correctness of artifacts.", "[main_test#19]")
         numberOfColumns++;
     }
 
-    REQUIRE(numberOfColumns == 4);
+    REQUIRE(numberOfColumns == 5);
 
     REQUIRE(artiffactRecords.at(0).find("id") != artiffactRecords.at(0).end());
     REQUIRE(artiffactRecords.at(0).find("elf") != artiffactRecords.at(0).end());
     REQUIRE(artiffactRecords.at(0).find("path") != artiffactRecords.at(0).end());
     REQUIRE(artiffactRecords.at(0).find("md5") != artiffactRecords.at(0).end());
+    REQUIRE(artiffactRecords.at(0).find("checksum_algorithm") != artiffactRecords.at(0).end());
 
     REQUIRE(artiffactRecords.at(0).at("path") == "/usr/include/x86_64-linux-gnu/bits/types.h");
 
@@ -3337,4 +3440,165 @@ TEST_CASE("Test the correctness of bit fields.", "[main_test#20]")
 
     REQUIRE(remove("./test_db.sqlite") == 0);
     delete idc;
-}
\ No newline at end of file
+}
+TEST_CASE("Test the type cache counters.", "[main_test#21]")
+{
+    Juicer          juicer;
+    IDataContainer* idc = 0;
+    std::string     inputFile{TEST_FILE_1};
+
+    idc = IDataContainer::Create(IDC_TYPE_SQLITE, "./test_db.sqlite");
+    REQUIRE(idc != nullptr);
+
+    juicer.setIDC(idc);
+
+    REQUIRE(juicer.parse(inputFile) == JUICER_OK);
+
+    /**
+     * Types such as int are referenced by many members, so they must be served from the cache.
+     */
+    uint64_t hits   = juicer.getTypeCacheHits();
+    uint64_t misses = juicer.getTypeCacheMisses();
+
+    REQUIRE(hits > 0);
+    REQUIRE(misses > 0);
+
+    /**
+     * The cache is per parse, so parsing the same file again gives the same counts.
+     */
+    REQUIRE(juicer.parse(inputFile) == JUICER_OK);
+    REQUIRE(juicer.getTypeCacheHits() == hits);
+    REQUIRE(juicer.getTypeCacheMisses() == misses);
+
+    ((SQLiteDB*)(idc))->close();
+    REQUIRE(remove("./test_db.sqlite") == 0);
+    delete idc;
+}
+
+TEST_CASE("Test juicing several ELF files into the same database.", "[main_test#22]")
+{
+    Juicer                   juicer;
+    IDataContainer*          idc = 0;
+    sqlite3*                 database;
+    char*                    errorMessage = nullptr;
+    std::vector<std::string> inputFiles{TEST_FILE_1, TEST_FILE_2};
+
+    idc = IDataContainer::Create(IDC_TYPE_SQLITE, "./test_db.sqlite");
+    REQUIRE(idc != nullptr);
+
+    juicer.setIDC(idc);
+    juicer.setJobs(2);
+
+    REQUIRE(juicer.parse(inputFiles) == JUICER_OK);
+
+    ((SQLiteDB*)(idc))->close();
+
+    REQUIRE(sqlite3_open("./test_db.sqlite", &database) == SQLITE_OK);
+
+    std::vector<std::map<std::string, std::string>> elfRecords{};
+
+    REQUIRE(sqlite3_exec(database, "SELECT * FROM elfs;", selectCallbackUsingColNameAsKey, &elfRecords, &errorMessage) == SQLITE_OK);
+    REQUIRE(elfRecords.size() == 2);
+
+    std::vector<std::map<std::string, std::string>> circleRecords{};
+
+    REQUIRE(sqlite3_exec(database, "SELECT * FROM symbols WHERE name = \"Circle\";", selectCallbackUsingColNameAsKey, &circleRecords, &errorMessage) ==
+            SQLITE_OK);
+    REQUIRE(circleRecords.size() == 1);
+
+    sqlite3_close(database);
+
+    REQUIRE(remove("./test_db.sqlite") == 0);
+    delete idc;
+}
+
+TEST_CASE("Test that incremental mode skips ELF files that did not change.", "[main_test#23]")
+{
+    Juicer          juicer;
+    IDataContainer* idc = 0;
+    std::string     inputFile{TEST_FILE_1};
+
+    idc = IDataContainer::Create(IDC_TYPE_SQLITE, "./test_db.sqlite");
+    REQUIRE(idc != nullptr);
+
+    juicer.setIDC(idc);
+    juicer.setIncremental(true);
+
+    REQUIRE(juicer.parse(inputFile) == JUICER_OK);
+
+    uint64_t hits       = juicer.getChecksumCache().getHits();
+    uint64_t misses     = juicer.getChecksumCache().getMisses();
+    uint64_t elfs       = Stats::getCount(STATS_COUNTER_ELFS);
+    uint64_t statements = Stats::getCount(STATS_COUNTER_SQL_STATEMENTS);
+    uint64_t statHits   = Stats::getCount(STATS_COUNTER_CHECKSUM_CACHE_HITS);
+    uint64_t statMisses = Stats::getCount(STATS_COUNTER_CHECKSUM_CACHE_MISSES);
+
+    /**
+     * The second parse only looks up the checksum of the ELF itself. None of its artifacts are hashed.
+     */
+    REQUIRE(juicer.parse(inputFile) == JUICER_OK);
+    REQUIRE(juicer.getChecksumCache().getHits() == hits + 1);
+    REQUIRE(juicer.getChecksumCache().getMisses() == misses);
+    REQUIRE(Stats::getCount(STATS_COUNTER_CHECKSUM_CACHE_HITS) == statHits + 1);
+    REQUIRE(Stats::getCount(STATS_COUNTER_CHECKSUM_CACHE_MISSES) == statMisses);
+
+    /**
+     * Nor is the ELF read or written. The only statement run is the one that found it in the database.
+     */
+    REQUIRE(Stats::getCount(STATS_COUNTER_ELFS) == elfs);
+    REQUIRE(Stats::getCount(STATS_COUNTER_SQL_STATEMENTS) == statements + 1);
+
+    ((SQLiteDB*)(idc))->close();
+    REQUIRE(remove("./test_db.sqlite") == 0);
+    delete idc;
+}
+
+TEST_CASE("Test that reading CUs with several jobs writes the same database as one job.", "[main_test#24]")
+{
+    /**
+     * Both CUs of TEST_FILE_5 define the types of test_file1.h, so merging the second
+     * CU's partial ELF finds symbols, fields and enumerators the first one already has.
+     */
+    juiceTestFile(TEST_FILE_5, "./test_db_serial.sqlite", 1, false);
+    juiceTestFile(TEST_FILE_5, "./test_db_parallel.sqlite", 4, false);
+
+    requireSameRows(dumpQueries, "./test_db_serial.sqlite", "./test_db_parallel.sqlite");
+
+    REQUIRE(remove("./test_db_serial.sqlite") == 0);
+    REQUIRE(remove("./test_db_parallel.sqlite") == 0);
+}
+
+TEST_CASE("Test that writing the symbols while the ELF is read writes the same database as writing it at the end.", "[main_test#25]")
+{
+    juiceTestFile(TEST_FILE_1, "./test_db_at_end.sqlite", 1, false);
+    juiceTestFile(TEST_FILE_1, "./test_db_pipelined.sqlite", 1, true);
+
+    requireSameRows(contentQueries, "./test_db_at_end.sqlite", "./test_db_pipelined.sqlite");
+
+    REQUIRE(remove("./test_db_at_end.sqlite") == 0);
+    REQUIRE(remove("./test_db_pipelined.sqlite") == 0);
+}
+
+TEST_CASE("Test that the initial data of a variable is read from where it lies in its section.", "[main_test#26]")
+{
+    Juicer               juicer;
+    InitialDataRecorder  recorder;
+    std::string          inputFile{TEST_FILE_1};
+    /* another_array lies well past the start of .data. */
+    int                  anotherArray[] = {20, 21, 22, 34};
+    int                  vectorY        = 30;
+    std::vector<uint8_t> anotherArrayData(sizeof(anotherArray));
+    std::vector<uint8_t> vectorYData(sizeof(vectorY));
+
+    memcpy(anotherArrayData.data(), anotherArray, sizeof(anotherArray));
+    memcpy(vectorYData.data(), &vectorY, sizeof(vectorY));
+
+    juicer.setIDC(&recorder);
+    juicer.setExtras(true);
+
+    REQUIRE(juicer.parse(inputFile) == JUICER_OK);
+    REQUIRE(recorder.initializedSymbolData.count("another_array") == 1);
+    REQUIRE(recorder.initializedSymbolData.at("another_array") == anotherArrayData);
+    REQUIRE(recorder.initializedSymbolData.count("vector_y") == 1);
+    REQUIRE(recorder.initializedSymbolData.at("vector_y") == vectorYData);
+}